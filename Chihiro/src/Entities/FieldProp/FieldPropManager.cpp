@@ -32,7 +32,7 @@ void FieldPropManager::SpawnFieldPropFromScript(FieldPropRespawnInfo prop, int32
 
         FieldPropRegenInfo ri = FieldPropRegenInfo{0, (uint32_t)lifeTime};
         ri.pRespawnInfo = prop;
-        m_vRespawnList.emplace_back(ri);
+        m_vRespawnList.push(ri);
     }
 }
 
@@ -54,7 +54,7 @@ void FieldPropManager::RegisterFieldProp(FieldPropRespawnInfo prop)
         m_vRespawnInfo.emplace_back(info);
         FieldPropRegenInfo ri = FieldPropRegenInfo{propTemplate->nRegenTime + sWorld.GetArTime(), propTemplate->nLifeTime};
         ri.pRespawnInfo = info;
-        m_vRespawnList.emplace_back(ri);
+        m_vRespawnList.push(ri);
     }
 }
 
@@ -68,59 +68,53 @@ void FieldPropManager::onFieldPropDelete(FieldProp *prop)
     {
         NG_UNIQUE_GUARD writeGuard(i_lock);
 
-        auto pos = std::find_if(m_vExpireObject.begin(), m_vExpireObject.end(), [&prop](const FieldProp *fp) { return fp->GetHandle() == prop->GetHandle(); });
-        if (pos != m_vExpireObject.end()) {
-            m_vExpireObject.erase(pos);
-        }
+        m_vExpireObject.erase(prop->GetHandle());
 
         if (!prop->m_PropInfo.bOnce) {
             FieldPropRegenInfo ri = FieldPropRegenInfo{prop->m_pFieldPropBase->nRegenTime + sWorld.GetArTime(), prop->nLifeTime};
             ri.pRespawnInfo = prop->m_PropInfo;
-            m_vRespawnList.emplace_back(ri);
+            m_vRespawnList.push(ri);
         }
     }
 }
 
+void FieldPropManager::addExpireObject(FieldProp *pProp)
+{
+    m_vExpireObject[pProp->GetHandle()] = pProp;
+    m_vExpireQueue.push(FieldPropExpireInfo{pProp->m_nRegenTime + pProp->nLifeTime, pProp->GetHandle()});
+}
+
 void FieldPropManager::Update(uint32_t /* diff*/)
 {
     uint32_t ct = sWorld.GetArTime();
-    std::vector<FieldPropRegenInfo> vRegenInfo{};
-    std::vector<FieldProp *> vDeleteList{};
 
     // "Critical section" for lock (yeah, I prefer those)
     {
         NG_UNIQUE_GUARD writeGuard(i_lock);
-        for (auto it = m_vRespawnList.begin(); it != m_vRespawnList.end();) {
-            if (it->tNextRegen < ct) {
-                vRegenInfo.emplace_back(*it);
-                it = m_vRespawnList.erase(it);
-            }
-            else {
-                ++it;
-            }
+        while (!m_vRespawnList.empty() && m_vRespawnList.top().tNextRegen < ct) {
+            // Copy the entry and pop it first, a reference to top() must not be held while Create runs
+            FieldPropRegenInfo rg = m_vRespawnList.top();
+            m_vRespawnList.pop();
+            FieldProp *pProp = FieldProp::Create(this, rg.pRespawnInfo, rg.nLifeTime);
+            if (pProp->nLifeTime != 0)
+                addExpireObject(pProp);
         }
 
-        if (!vRegenInfo.empty()) {
-            for (auto &rg : vRegenInfo) {
-                FieldProp *pProp = FieldProp::Create(this, rg.pRespawnInfo, rg.nLifeTime);
-                if (pProp->nLifeTime != 0) {
-                    m_vExpireObject.emplace_back(pProp);
-                }
-            }
-        }
-
-        for (auto &fp : m_vExpireObject) {
-            if (fp->m_nRegenTime + fp->nLifeTime < ct)
-                vDeleteList.emplace_back(fp);
+        while (!m_vExpireQueue.empty() && m_vExpireQueue.top().tExpire < ct) {
+            auto pos = m_vExpireObject.find(m_vExpireQueue.top().nHandle);
+            m_vExpireQueue.pop();
+            if (pos == m_vExpireObject.end())
+                continue;
+            m_vDeleteList.emplace_back(pos->second);
+            m_vExpireObject.erase(pos);
         }
 
-        if (!vDeleteList.empty()) {
-            for (auto &fp : vDeleteList) {
-                if (fp->IsInWorld() && !fp->IsDeleteRequested()) {
-                    sWorld.RemoveObjectFromWorld(fp);
-                    fp->DeleteThis();
-                }
+        for (auto &fp : m_vDeleteList) {
+            if (fp->IsInWorld() && !fp->IsDeleteRequested()) {
+                sWorld.RemoveObjectFromWorld(fp);
+                fp->DeleteThis();
             }
         }
+        m_vDeleteList.clear();
     } //- Lock end
 }
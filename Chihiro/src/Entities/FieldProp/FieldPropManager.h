@@ -16,6 +16,8 @@
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <queue>
+
 #include "Common.h"
 #include "FieldProp.h"
 #include "SharedMutex.h"
@@ -27,11 +29,20 @@ struct FieldPropRegenInfo {
         nLifeTime = lt;
     }
 
+    bool operator>(const FieldPropRegenInfo &rhs) const { return tNextRegen > rhs.tNextRegen; }
+
     FieldPropRespawnInfo pRespawnInfo;
     uint32_t tNextRegen;
     uint32_t nLifeTime;
 };
 
+struct FieldPropExpireInfo {
+    bool operator>(const FieldPropExpireInfo &rhs) const { return tExpire > rhs.tExpire; }
+
+    uint32_t tExpire;
+    uint32_t nHandle;
+};
+
 class FieldPropManager : public FieldPropDeleteHandler {
 public:
     static FieldPropManager &Instance()
@@ -52,9 +63,16 @@ public:
     void Update(uint32_t diff);
 
 private:
+    void addExpireObject(FieldProp *pProp);
+
     std::vector<FieldPropRespawnInfo> m_vRespawnInfo{};
-    std::vector<FieldPropRegenInfo> m_vRespawnList{};
-    std::vector<FieldProp *> m_vExpireObject{};
+    // Both queues are ordered by due time, earliest on top
+    std::priority_queue<FieldPropRegenInfo, std::vector<FieldPropRegenInfo>, std::greater<FieldPropRegenInfo>> m_vRespawnList{};
+    std::priority_queue<FieldPropExpireInfo, std::vector<FieldPropExpireInfo>, std::greater<FieldPropExpireInfo>> m_vExpireQueue{};
+    // Props with a lifetime that are still on the map, keyed by handle.
+    // Queue entries whose prop is gone from here are skipped when they come due.
+    std::unordered_map<uint32_t, FieldProp *> m_vExpireObject{};
+    std::vector<FieldProp *> m_vDeleteList{};
     NG_SHARED_MUTEX i_lock;
 
 protected:
@@ -77,7 +77,7 @@ bool Item::IsWearable()
     return (~((GetItemInstance().GetFlag()) >> FlagBits::ITEM_FLAG_FAILED) & 1) != 0;
 }
 
-void Item::DBUpdate()
+void Item::DBUpdate(BatchStatement *pBatch)
 {
     /*if (!m_bIsNeedUpdateToDB)
         return;*/
@@ -103,7 +103,10 @@ void Item::DBUpdate()
     stmt->setInt32(i++, GetItemInstance().GetExpire());
     stmt->setInt32(i, GetItemInstance().GetUID());
 
-    CharacterDatabase.Execute(stmt);
+    if (pBatch != nullptr)
+        pBatch->Append(stmt);
+    else
+        CharacterDatabase.Execute(stmt);
 
     m_bIsNeedUpdateToDB = false;
 }
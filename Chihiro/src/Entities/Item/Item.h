@@ -21,6 +21,7 @@
 #include "ItemInstance.h"
 #include "Object.h"
 
+class BatchStatement;
 class Unit;
 class Summon;
 struct TS_SC_ENTER;
@@ -110,7 +111,8 @@ public:
     bool IsInInventory() const;
     bool IsInStorage() const;
 
-    void DBUpdate();
+    //! Queues the update, into pBatch when the caller saves many items at once
+    void DBUpdate(BatchStatement *pBatch = nullptr);
     void DBInsert();
     void SetCurrentEndurance(int32_t n);
     int32_t GetMaxEndurance() const;
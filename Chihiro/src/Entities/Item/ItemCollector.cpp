@@ -24,7 +24,7 @@ ItemCollector::~ItemCollector()
 {
     NG_UNIQUE_GUARD writeGuard(i_lock);
     for (auto &item : m_vItemList) {
-        Item::PendFreeItem(item.second);
+        Item::PendFreeItem(item.second.pItem);
     }
 }
 
@@ -32,10 +32,13 @@ void ItemCollector::RegisterItem(Item *pItem)
 {
     if (pItem == nullptr)
         return;
+    // The hold time is captured once at drop, a config reload only affects items dropped afterwards
+    uint32_t nExpireTime = pItem->m_nDropTime + (uint32_t)sWorld.getIntConfig(CONFIG_ITEM_HOLD_TIME);
+
     NG_UNIQUE_GUARD writeGuard(i_lock);
-    if (m_vItemList.count(pItem->GetHandle()) != 0)
+    if (!m_vItemList.emplace(pItem->GetHandle(), GroundItem{pItem, nExpireTime}).second)
         return;
-    m_vItemList[pItem->GetHandle()] = pItem;
+    m_qExpireQueue.push(ExpireEntry{nExpireTime, pItem->GetHandle()});
 }
 
 bool ItemCollector::UnregisterItem(Item *pItem)
@@ -43,26 +46,34 @@ bool ItemCollector::UnregisterItem(Item *pItem)
     if (pItem == nullptr)
         return false;
     NG_UNIQUE_GUARD writeGuard(i_lock);
-    if (m_vItemList.count(pItem->GetHandle()) == 0)
-        return false;
-
-    m_vItemList.erase(pItem->GetHandle());
-    return true;
+    // The queue entry stays behind and is discarded once it expires
+    return m_vItemList.erase(pItem->GetHandle()) != 0;
 }
 
 void ItemCollector::Update()
 {
-    NG_UNIQUE_GUARD writeGuard(i_lock);
     uint32_t ct = sWorld.GetArTime();
-    for (ItemMap::iterator itr = m_vItemList.begin(), next; itr != m_vItemList.end(); itr = next) {
-        next = itr;
-        ++next;
 
-        if (itr->second->m_nDropTime + sWorld.getIntConfig(CONFIG_ITEM_HOLD_TIME) <= ct) {
-            if (itr->second->IsInWorld())
-                sWorld.RemoveObjectFromWorld(itr->second);
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        while (!m_qExpireQueue.empty() && m_qExpireQueue.top().nExpireTime <= ct) {
+            ExpireEntry entry = m_qExpireQueue.top();
+            m_qExpireQueue.pop();
+
+            auto itr = m_vItemList.find(entry.nHandle);
+            // Picked up (or picked up and dropped again) since this entry was queued
+            if (itr == m_vItemList.end() || itr->second.nExpireTime != entry.nExpireTime)
+                continue;
+
+            m_vExpiredItems.emplace_back(itr->second.pItem);
             m_vItemList.erase(itr);
-            Item::PendFreeItem(itr->second);
         }
     }
+
+    for (auto &pItem : m_vExpiredItems) {
+        if (pItem->IsInWorld())
+            sWorld.RemoveObjectFromWorld(pItem);
+        Item::PendFreeItem(pItem);
+    }
+    m_vExpiredItems.clear();
 }
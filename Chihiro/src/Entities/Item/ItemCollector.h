@@ -16,6 +16,8 @@
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <queue>
+
 #include "Common.h"
 #include "SharedMutex.h"
 
@@ -39,9 +41,26 @@ public:
     void Update();
 
 private:
-    typedef std::unordered_map<uint32_t, Item *> ItemMap;
+    struct GroundItem {
+        Item *pItem;
+        uint32_t nExpireTime;
+    };
+
+    // Ordered by expire time, earliest on top. Entries are not removed on unregister,
+    // they are dropped lazily once they reach the top and no longer match m_vItemList.
+    struct ExpireEntry {
+        uint32_t nExpireTime;
+        uint32_t nHandle;
+
+        bool operator>(const ExpireEntry &rhs) const { return nExpireTime > rhs.nExpireTime; }
+    };
+
+    typedef std::unordered_map<uint32_t, GroundItem> ItemMap;
+    typedef std::priority_queue<ExpireEntry, std::vector<ExpireEntry>, std::greater<ExpireEntry>> ExpireQueue;
 
     ItemMap m_vItemList;
+    ExpireQueue m_qExpireQueue;
+    std::vector<Item *> m_vExpiredItems{};
     NG_SHARED_MUTEX i_lock;
 
 protected:
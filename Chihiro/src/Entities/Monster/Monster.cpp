@@ -31,6 +31,7 @@
 #include "RegionContainer.h"
 #include "Skill.h"
 #include "Summon.h"
+#include "TickScheduler.h"
 #include "World.h"
 #include "XPacket.h"
 
@@ -388,6 +389,11 @@ void Monster::Update(uint32_t diff)
     uint32_t ct = sWorld.GetArTime();
     MONSTER_STATUS ms = GetStatus();
 
+    // Idle monsters are the first to give way when the world cannot keep up,
+    // they only look for targets and start wandering on some ticks
+    if (ms == STATUS_NORMAL && !bIsMoving && !HasFlag(UNIT_FIELD_STATUS, STATUS_MOVE_PENDED) && sTickScheduler.IsDeferred(GetHandle()))
+        return;
+
     if (ms != STATUS_NORMAL) {
         if ((int32_t)ms > 0) {
             if ((int32_t)ms <= 3) {
@@ -446,6 +452,19 @@ void Monster::Update(uint32_t diff)
     Unit::Update(diff);
 }
 
+bool Monster::CanSleep() const
+{
+    // Anything still going on keeps it updating until it settled down
+    return IsInWorld() && !IsDeleteRequested() && !bForceKill && m_nStatus == STATUS_NORMAL && !bIsMoving && !HasFlag(UNIT_FIELD_STATUS, STATUS_MOVE_PENDED) && GetHealth() != 0 &&
+        m_vHateList.empty() && m_vStateList.empty() && m_hTamer == 0;
+}
+
+void Monster::OnWake()
+{
+    // Regen and state expiry go by time, so one update makes up for the whole sleep
+    OnUpdate();
+}
+
 void Monster::processDead(uint32_t t)
 {
     if (m_pDeleteHandler != nullptr) {
@@ -1190,42 +1209,43 @@ void Monster::processMove(uint32_t t)
     }
 }
 
-void Monster::processFirstAttack(uint32_t t)
+void Monster::processFirstAttack(uint32_t /* t*/)
 {
     if (GetStatus() != STATUS_NORMAL || !(IsAgent() || IsFirstAttacker() || IsBattleRevenger()))
         return;
 
-    std::vector<uint32_t> vResult{};
     std::vector<Monster *> vSameGroup{};
     uint32_t target{0};
 
     if (IsAgent()) {
     }
     else {
-        sWorld.EnumMovableObject(this->GetPosition(), GetLayer(), GetFirstAttackRange(), vResult, true, true);
-
-        auto distance = GetFirstAttackRange() + 1.0f;
-        for (const auto &handle : vResult) {
+        // Squared distances, the nearest enemy wins just the same
+        auto distance = (GetFirstAttackRange() + 1.0f) * (GetFirstAttackRange() + 1.0f);
+        auto summonRange = (GetFirstAttackRange() * 0.5f) * (GetFirstAttackRange() * 0.5f);
+        sWorld.DoEachMovableObject(RangeCircle{GetPositionX(), GetPositionY(), GetFirstAttackRange()}, GetLayer(), [&](const RangeCandidate &candidate) {
+            auto handle = candidate.handle;
             auto unit = sMemoryPool.GetObjectInWorld<Unit>(handle);
-            if (unit != nullptr && unit->GetHealth() != 0) {
-                if (!IsFirstAttacker() && unit->IsMonster() && unit->GetTargetHandle() != 0)
-                    target = unit->GetTargetHandle();
-
-                if (IsGroupFirstAttacker() && unit->IsMonster() && unit != this) {
-                    auto mob = unit->As<Monster>();
-                    if (mob->GetMonsterGroup() == GetMonsterGroup())
-                        vSameGroup.emplace_back(mob);
-                }
+            if (unit == nullptr || unit->GetHealth() == 0)
+                return;
 
-                if (IsFirstAttacker() && IsEnemy(unit, false)) {
-                    auto _distance = unit->GetCurrentPosition(t).GetExactDist2d(this);
-                    if (!unit->IsSummon() || (GetFirstAttackRange() * 0.5f >= _distance && distance > _distance)) {
-                        distance = _distance;
-                        target = handle;
-                    }
+            if (!IsFirstAttacker() && unit->IsMonster() && unit->GetTargetHandle() != 0)
+                target = unit->GetTargetHandle();
+
+            if (IsGroupFirstAttacker() && unit->IsMonster() && unit != this) {
+                auto mob = unit->As<Monster>();
+                if (mob->GetMonsterGroup() == GetMonsterGroup())
+                    vSameGroup.emplace_back(mob);
+            }
+
+            if (IsFirstAttacker() && IsEnemy(unit, false)) {
+                auto _distance = GetExactDist2dSq(candidate.x, candidate.y);
+                if (!unit->IsSummon() || (summonRange >= _distance && distance > _distance)) {
+                    distance = _distance;
+                    target = handle;
                 }
             }
-        }
+        });
     }
 
     if (target == 0)
@@ -1335,7 +1355,7 @@ void Monster::procQuest(Position pos, Unit *pKiller, takePriority pPriority, std
         }
         else {
             sGroupManager.DoEachMemberTag(vPartyContribute.front().nPartyID, [&vPlayer, pos](PartyMemberTag &tag) {
-                if (tag.bIsOnline && tag.pPlayer != nullptr && tag.pPlayer->GetExactDist2d(&pos) <= 500.0f) {
+                if (tag.bIsOnline && tag.pPlayer != nullptr && tag.pPlayer->GetExactDist2dSq(&pos) <= 500.0f * 500.0f) {
                     vPlayer.emplace_back(tag.pPlayer);
                 }
             });
@@ -138,8 +138,14 @@ public:
     bool IsAlly(const Unit *pTarget) override;
     void TriggerForceKill(Player *pPlayer);
 
+    /// \brief true if only a player coming close can change anything about this monster
+    bool CanSleep() const;
+    /// \brief Catches up on regen and expired states after a sleep
+    void OnWake();
+
     MonsterDeleteHandler *m_pDeleteHandler{nullptr};
     bool m_bNearClient;
+    bool m_bSleeping{false};
 
 protected:
     HateTag *getHateTag(uint32_t handle, uint32_t t);
@@ -18,6 +18,7 @@
 #include "Object.h"
 
 #include "ClientPackets.h"
+#include "EnterPacketEncoder.h"
 #include "FieldPropManager.h"
 #include "Item.h"
 #include "Messages.h"
@@ -86,6 +87,26 @@ void Object::RemoveFromWorld()
     m_inWorld = false;
 }
 
+void Object::bumpValuesRevision(uint16_t index)
+{
+    // The values read by Player/NPC/Summon/Monster::EnterPacket behind the creature info
+    switch (index) {
+    case UNIT_FIELD_UID:
+    case UNIT_FIELD_SEX:
+    case UNIT_FIELD_MODEL:
+    case UNIT_FIELD_MODEL + 1:
+    case UNIT_FIELD_MODEL + 2:
+    case UNIT_FIELD_MODEL + 3:
+    case UNIT_FIELD_MODEL + 4:
+    case UNIT_FIELD_JOB:
+    case PLAYER_FIELD_GUILD_ID:
+        m_nValuesRevision.fetch_add(1, std::memory_order_relaxed);
+        break;
+    default:
+        break;
+    }
+}
+
 void Object::SetInt32Value(uint16_t index, int32_t value)
 {
     ASSERT(index < _valuesCount || PrintIndexError(index, true));
@@ -94,6 +115,7 @@ void Object::SetInt32Value(uint16_t index, int32_t value)
         m_int32Values[index] = value;
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -108,6 +130,7 @@ void Object::SetUInt32Value(uint16_t index, uint32_t value)
         _uint32Values[index] = value;
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -131,6 +154,7 @@ void Object::SetUInt64Value(uint16_t index, uint64_t value)
         _changedFields[index] = true;
         _changedFields[index + 1] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -146,6 +170,7 @@ bool Object::AddUInt64Value(uint16_t index, uint64_t value)
         _changedFields[index] = true;
         _changedFields[index + 1] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -165,6 +190,7 @@ bool Object::RemoveUInt64Value(uint16_t index, uint64_t value)
         _changedFields[index] = true;
         _changedFields[index + 1] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -183,6 +209,7 @@ void Object::SetFloatValue(uint16_t index, float value)
         m_floatValues[index] = value;
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -203,6 +230,7 @@ void Object::SetByteValue(uint16_t index, uint8_t offset, uint8_t value)
         _uint32Values[index] |= uint32_t(uint32_t(value) << (offset * 8));
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -223,6 +251,7 @@ void Object::SetUInt16Value(uint16_t index, uint8_t offset, uint16_t value)
         _uint32Values[index] |= uint32_t(uint32_t(value) << (offset * 16));
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -287,6 +316,7 @@ void Object::SetFlag(uint16_t index, uint32_t newFlag)
         _uint32Values[index] = newval;
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -305,6 +335,7 @@ void Object::RemoveFlag(uint16_t index, uint32_t oldFlag)
         _uint32Values[index] = newval;
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -324,6 +355,7 @@ void Object::SetByteFlag(uint16_t index, uint8_t offset, uint8_t newFlag)
         _uint32Values[index] |= uint32_t(uint32_t(newFlag) << (offset * 8));
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -343,6 +375,7 @@ void Object::RemoveByteFlag(uint16_t index, uint8_t offset, uint8_t oldFlag)
         _uint32Values[index] &= ~uint32_t(uint32_t(oldFlag) << (offset * 8));
         _changedFields[index] = true;
 
+        bumpValuesRevision(index);
         if (m_inWorld && !m_objectUpdated) {
             m_objectUpdated = true;
         }
@@ -370,43 +403,7 @@ WorldObject::~WorldObject() = default;
 
 void WorldObject::SendEnterMsg(Player *pPlayer)
 {
-    Position tmpPos = this->GetCurrentPosition(sWorld.GetArTime());
-    TS_SC_ENTER enterPct{};
-    enterPct.type = GetMainType();
-    enterPct.handle = GetHandle();
-    enterPct.x = tmpPos.GetPositionX();
-    enterPct.y = tmpPos.GetPositionY();
-    enterPct.z = tmpPos.GetPositionZ();
-    enterPct.layer = GetLayer();
-    enterPct.objType = (TS_SC_ENTER__OBJ_TYPE)((uint8_t)GetSubType());
-
-    switch (GetSubType()) {
-    case ST_NPC:
-        NPC::EnterPacket(enterPct, this->As<NPC>(), pPlayer);
-        break;
-    case ST_Player:
-        Player::EnterPacket(enterPct, this->As<Player>(), pPlayer);
-        break;
-    case ST_Summon:
-        Summon::EnterPacket(enterPct, this->As<Summon>(), pPlayer);
-        break;
-    case ST_Mob:
-        Monster::EnterPacket(enterPct, this->As<Monster>(), pPlayer);
-        break;
-    case ST_Object:
-        Item::EnterPacket(enterPct, this->As<Item>());
-        break;
-    case ST_FieldProp:
-        FieldProp::EnterPacket(enterPct, this->As<FieldProp>(), pPlayer);
-        break;
-    case ST_SkillProp:
-        SkillProp::EnterPacket(enterPct, this->As<SkillProp>(), pPlayer);
-        break;
-    default:
-        break;
-    }
-
-    pPlayer->SendPacket(enterPct);
+    sEnterPacketEncoder.SendEnter(pPlayer, this);
     if (IsPlayer())
         Messages::SendWearInfo(pPlayer, this->As<Unit>());
 }
@@ -16,6 +16,8 @@
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+
 #include "ByteBuffer.h"
 #include "Common.h"
 #include "Util.h"
@@ -151,6 +153,9 @@ public:
     }
 
     bool IsInWorld() const { return m_inWorld; }
+    /// \brief Changes whenever the name or one of the values the enter info is built from changes
+    /// HP, MP, position and status are sent fresh with every enter and do not change it.
+    uint32_t GetValuesRevision() const { return m_nValuesRevision.load(std::memory_order_relaxed); }
 
     bool IsDeleteRequested() const { return m_bDeleteRequest; }
 
@@ -345,6 +350,9 @@ protected:
     bool *_changedFields;
     uint16_t _valuesCount;
     bool m_objectUpdated;
+    // Bumped when a value of the cached enter info changes (name, model, job, guild, ...), read by other threads
+    std::atomic<uint32_t> m_nValuesRevision{0};
+    void bumpValuesRevision(uint16_t index);
 
     MainType _mainType;
     ObjType _objType;
@@ -587,7 +595,11 @@ public:
 
     virtual const std::string &GetNameAsString() { return m_name; }
 
-    void SetName(const std::string &newname) { m_name = newname; }
+    void SetName(const std::string &newname)
+    {
+        m_name = newname;
+        ++m_nValuesRevision;
+    }
 
     Region *pRegion{nullptr};
     int32_t region_index;
@@ -75,12 +75,20 @@ Player::~Player()
 
 void Player::CleanupsBeforeDelete()
 {
+    // The account's next character list has to see the states and quests written here
+    DatabaseWorkerPool<CharacterDatabaseConnection>::OrderScope order(static_cast<uint32_t>(GetAccountID()));
     CharacterDatabase.DirectPExecute("UPDATE `Character` SET logout_time = NOW() WHERE sid = %u", GetUInt32Value(UNIT_FIELD_UID));
     if (IsInWorld()) {
         RemoveAllSummonFromWorld();
         sWorld.RemoveObjectFromWorld(this);
     }
 
+    if (m_WorldLocation != nullptr) {
+        sWorldLocationMgr.RemoveFromLocation(this);
+        m_WorldLocation = nullptr;
+        m_nWorldLocationId = 0;
+    }
+
     if (GetPartyID() != 0)
         sGroupManager.onLogout(GetPartyID(), this);
 
@@ -105,11 +113,12 @@ void Player::CleanupsBeforeDelete()
     m_Storage.m_vList.clear();
     m_Storage.m_vExpireItemList.clear();
 
+    auto stateBatch = CharacterDatabase.BeginBatch(CHARACTER_REP_STATE, CHARACTER_REP_STATE_BATCH);
     for (auto &t : m_vSummonList) {
         if (t != nullptr) {
             State::DB_ClearState(t);
             for (auto &state : t->m_vStateList)
-                State::DB_InsertState(t, state);
+                State::DB_InsertState(t, state, &stateBatch);
             t->DeleteThis();
         }
     }
@@ -117,13 +126,16 @@ void Player::CleanupsBeforeDelete()
 
     State::DB_ClearState(this);
     for (auto &state : m_vStateList)
-        State::DB_InsertState(this, state);
+        State::DB_InsertState(this, state, &stateBatch);
+    CharacterDatabase.ExecuteBatch(stateBatch);
 
+    auto questBatch = CharacterDatabase.BeginBatch(CHARACTER_ADD_QUEST, CHARACTER_ADD_QUEST_BATCH);
     for (auto &q : m_QuestManager.m_vActiveQuest) {
-        Quest::DB_Insert(this, q);
+        Quest::DB_Insert(this, q, &questBatch);
         delete q;
     }
     m_QuestManager.m_vActiveQuest.clear();
+    CharacterDatabase.ExecuteBatch(questBatch);
 }
 
 void Player::EnterPacket(TS_SC_ENTER &pEnterPct, Player *pPlayer, Player *pReceiver)
@@ -138,9 +150,6 @@ void Player::EnterPacket(TS_SC_ENTER &pEnterPct, Player *pPlayer, Player *pRecei
     playerInfo.ride_handle = pPlayer->GetRideHandle();
     playerInfo.guild_id = pPlayer->GetInt32Value(PLAYER_FIELD_GUILD_ID);
     pEnterPct.playerInfo = playerInfo;
-
-    if (pPlayer->GetRideHandle() != 0)
-        Messages::sendEnterMessage(pPlayer, pPlayer->GetRideObject(), true);
 }
 
 bool Player::ReadCharacter(const std::string &_name, int32_t _race)
@@ -871,6 +880,8 @@ void Player::SendWearInfo()
 
 void Player::Save(bool bOnlyPlayer)
 {
+    // Saves also run from the world tick, outside of the session's scope
+    DatabaseWorkerPool<CharacterDatabaseConnection>::OrderScope order(static_cast<uint32_t>(GetAccountID()));
     // "UPDATE `Character` SET x = ?, y = ?, z = ?, layer = ?, exp = ?, lv = ?, hp = ?, mp = ?, stamina = ?, jlv = ?, jp = ?, total_jp = ?, job_0 = ?, job_1 = ?, job_2 = ?,
     // jlv_0 = ?, jlv_1 = ?, jlv_2 = ?, permission = ?, job = ?, gold = ?, party_id = ?, guild_id = ? WHERE sid = ?"
     PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_UPD_CHARACTER);
@@ -913,10 +924,15 @@ void Player::Save(bool bOnlyPlayer)
     CharacterDatabase.Execute(stmt);
 
     if (!bOnlyPlayer) {
+        // Items and quests are merged into multi row statements and committed together
+        SQLTransaction trans = CharacterDatabase.BeginTransaction();
+
+        auto itemBatch = CharacterDatabase.BeginBatch(CHARACTER_UPD_ITEM, CHARACTER_UPD_ITEM_BATCH, BATCH_KEYED_UPDATE);
         for (auto &item : m_Inventory.m_vList) {
             // if (item->m_bIsNeedUpdateToDB)
-            item->DBUpdate();
+            item->DBUpdate(&itemBatch);
         }
+        itemBatch.AppendTo(trans);
 
         // REPLACE query - acts as insert & update
         DB_ItemCoolTime(this);
@@ -927,11 +943,16 @@ void Player::Save(bool bOnlyPlayer)
             Summon::DB_UpdateSummon(this, summon);
         }
 
+        auto questBatch = CharacterDatabase.BeginBatch(CHARACTER_ADD_QUEST, CHARACTER_ADD_QUEST_BATCH);
         for (auto &q : m_QuestManager.m_vActiveQuest) {
             if (q == nullptr)
                 continue;
-            Quest::DB_Insert(this, q);
+            Quest::DB_Insert(this, q, &questBatch);
         }
+        questBatch.AppendTo(trans);
+
+        if (trans->GetSize() != 0)
+            CharacterDatabase.CommitTransaction(trans);
     }
 }
 
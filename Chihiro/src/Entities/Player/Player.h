@@ -341,6 +341,13 @@ public:
         m_session->SendPacket(packet);
     }
 
+    void SendPacketBatch(const XPacket &packets)
+    {
+        if (m_session == nullptr)
+            return;
+        m_session->SendPacketBatch(packets);
+    }
+
     WorldSession &GetSession() const { return *m_session; }
 
     void SetClientInfo(const std::string &value) { m_szClientInfo = value; }
@@ -352,6 +359,7 @@ public:
 
     Item *m_aBindSummonCard[6]{nullptr};
     WorldLocation *m_WorldLocation{nullptr};
+    uint32_t m_nWorldLocationSlot{0}; // position in m_WorldLocation->m_vIncludeClient
     int32_t m_nWorldLocationId{0};
     TimeSynch m_TS{200, 2, 10};
 
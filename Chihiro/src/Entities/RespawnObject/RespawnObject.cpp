@@ -21,12 +21,20 @@
 #include "Log.h"
 #include "MemPool.h"
 #include "ObjectMgr.h"
+#include "RegionSleep.h"
+#include "SpawnPointCache.h"
 #include "World.h"
 
 RespawnObject::RespawnObject(MonsterRespawnInfo rh)
     : info(RespawnInfo{rh})
 {
     m_nMaxRespawnNum = info.prespawn_count;
+    m_nSpawnArea = sSpawnPointCache.RegisterArea((int32_t)info.left, (int32_t)info.top, (int32_t)info.right, (int32_t)info.bottom);
+    auto regionSize = (float)sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE);
+    m_nRegionLeft = (uint32_t)(std::max(0.0f, std::min(info.left, info.right)) / regionSize);
+    m_nRegionTop = (uint32_t)(std::max(0.0f, std::min(info.top, info.bottom)) / regionSize);
+    m_nRegionRight = (uint32_t)(std::max(0.0f, std::max(info.left, info.right)) / regionSize);
+    m_nRegionBottom = (uint32_t)(std::max(0.0f, std::max(info.top, info.bottom)) / regionSize);
     lastDeadTime = 0;
 }
 
@@ -42,6 +50,10 @@ void RespawnObject::Update(uint32_t diff)
     if (lastDeadTime != 0 && lastDeadTime + info.interval > ct)
         return;
 
+    /// Nobody around the respawn rectangle, respawns go on at the usual pace once a player comes close
+    if (lastDeadTime != 0 && !sRegionSleep.IsAnyAwake(m_nRegionLeft, m_nRegionTop, m_nRegionRight, m_nRegionBottom, info.layer))
+        return;
+
     auto respawn_count = std::min(m_nMaxRespawnNum - info.count, info.inc);
 
     if (lastDeadTime == 0) {
@@ -51,21 +63,14 @@ void RespawnObject::Update(uint32_t diff)
 
     /// Do we need a respawn?
     if (respawn_count > 0) {
-        int32_t try_cnt = 0;
         for (uint32_t i = 0; i < respawn_count; ++i) {
-            /// Generate random respawn coordinates based on a rectangle
+            /// Pick one of the walkable points of the respawn rectangle
             int32_t x{};
             int32_t y{};
-
-            do {
-                x = irand((int32_t)info.left, (int32_t)info.right);
-                y = irand((int32_t)info.top, (int32_t)info.bottom);
-
-                if (++try_cnt > 500) {
-                    NG_LOG_ERROR("server.worldserver", "Cannot respawn monster - try_cnt = 500");
-                    return;
-                }
-            } while (GameContent::IsBlocked(x, y));
+            if (!sSpawnPointCache.GetRandomPoint(m_nSpawnArea, x, y)) {
+                NG_LOG_ERROR("server.worldserver", "Cannot respawn monster - no walkable point in respawn area");
+                return;
+            }
 
             /// Generate monster if not blocked
             auto monster = GameContent::RespawnMonster(x, y, info.layer, info.monster_id, info.is_wandering, info.way_point_id, this, true);
@@ -75,7 +80,7 @@ void RespawnObject::Update(uint32_t diff)
                 if (info.dungeon_id != 0) {
                     // monster.m_nDungeonId = info.dungeon_id;
                 }
-                m_vRespawnedMonster.emplace_back(monster->GetHandle());
+                m_sRespawnedMonster.emplace(monster->GetHandle());
                 info.count++;
             }
         }
@@ -90,11 +95,8 @@ void RespawnObject::onMonsterDelete(Monster *mob)
     lastDeadTime = sWorld.GetArTime();
     --info.count;
 
-    auto pos = std::find(m_vRespawnedMonster.begin(), m_vRespawnedMonster.end(), mob->GetHandle());
-    if (pos != m_vRespawnedMonster.end()) {
-        m_vRespawnedMonster.erase(pos);
+    if (m_sRespawnedMonster.erase(mob->GetHandle()) != 0)
         mob->m_pDeleteHandler = nullptr;
-    }
 
     if (m_nMaxRespawnNum < info.max_num)
         ++m_nMaxRespawnNum;
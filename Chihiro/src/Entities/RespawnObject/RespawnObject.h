@@ -15,6 +15,8 @@
  *  You should have received a copy of the GNU General Public License along
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <unordered_set>
+
 #include "Common.h"
 #include "GameRule.h"
 #include "Monster.h"
@@ -48,6 +50,12 @@ public:
 private:
     RespawnInfo info;
     uint32_t m_nMaxRespawnNum;
-    std::vector<uint32_t> m_vRespawnedMonster;
+    uint32_t m_nSpawnArea;
+    // Regions the respawn rectangle overlaps
+    uint32_t m_nRegionLeft;
+    uint32_t m_nRegionTop;
+    uint32_t m_nRegionRight;
+    uint32_t m_nRegionBottom;
+    std::unordered_set<uint32_t> m_sRespawnedMonster;
     uint32_t lastDeadTime;
 };
\ No newline at end of file
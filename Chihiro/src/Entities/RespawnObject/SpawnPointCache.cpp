@@ -0,0 +1,220 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpawnPointCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "Config.h"
+#include "GameContent.h"
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "Timer.h"
+#include "World.h"
+
+constexpr uint32_t SPAWN_POINT_MAGIC = 0x5053474E; // NGSP
+constexpr uint32_t SPAWN_POINT_VERSION = 2;
+
+uint32_t SpawnPointCache::RegisterArea(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    auto key = std::make_tuple(std::min(left, right), std::min(top, bottom), std::max(left, right), std::max(top, bottom));
+    auto it = m_mAreaIndex.find(key);
+    if (it != m_mAreaIndex.end())
+        return it->second;
+
+    auto nArea = static_cast<uint32_t>(m_vAreas.size());
+    m_vAreas.emplace_back(SpawnArea{std::get<0>(key), std::get<1>(key), std::get<2>(key), std::get<3>(key), 0, 0, 1});
+    m_mAreaIndex.emplace(key, nArea);
+
+    // Registered after the start, sample it right away
+    if (m_bInitialized)
+        build(m_vAreas.back());
+    return nArea;
+}
+
+void SpawnPointCache::Initialize(const std::string &szCacheFile)
+{
+    m_nMaxPoints = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.SpawnPointLimit", 1024), 1));
+    m_bInitialized = true;
+    if (m_vAreas.empty())
+        return;
+
+    if (load(szCacheFile)) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded %u spawn points of %u respawn areas from %s", static_cast<uint32_t>(m_vPoints.size()), static_cast<uint32_t>(m_vAreas.size()),
+            szCacheFile.c_str());
+        return;
+    }
+
+    uint32_t oldMSTime = getMSTime();
+    m_vPoints.clear();
+    for (auto &area : m_vAreas)
+        build(area);
+    NG_LOG_INFO("server.worldserver", ">> Sampled %u spawn points of %u respawn areas in %u ms", static_cast<uint32_t>(m_vPoints.size()), static_cast<uint32_t>(m_vAreas.size()),
+        GetMSTimeDiffToNow(oldMSTime));
+    save(szCacheFile);
+}
+
+bool SpawnPointCache::GetRandomPoint(uint32_t nArea, int32_t &x, int32_t &y) const
+{
+    if (nArea >= m_vAreas.size() || m_vAreas[nArea].nPointCount == 0)
+        return false;
+
+    auto &area = m_vAreas[nArea];
+    auto &point = m_vPoints[area.nFirstPoint + urand(0, area.nPointCount - 1)];
+    x = point.x;
+    y = point.y;
+    if (area.nStep <= 1)
+        return true;
+
+    // Somewhere in the cell around the center, the center itself is known to be walkable
+    int32_t nX = std::clamp(point.x - area.nStep / 2 + irand(0, area.nStep - 1), area.left, area.right);
+    int32_t nY = std::clamp(point.y - area.nStep / 2 + irand(0, area.nStep - 1), area.top, area.bottom);
+    if (!GameContent::IsBlocked(nX, nY)) {
+        x = nX;
+        y = nY;
+    }
+    return true;
+}
+
+int32_t SpawnPointCache::gridStep(const SpawnArea &area) const
+{
+    // Every integer point of the rectangle, or an even grid over it when there are too many
+    uint64_t nWidth = static_cast<uint64_t>(area.right - area.left) + 1;
+    uint64_t nHeight = static_cast<uint64_t>(area.bottom - area.top) + 1;
+    if (nWidth * nHeight <= m_nMaxPoints)
+        return 1;
+    return static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(nWidth * nHeight) / m_nMaxPoints)));
+}
+
+void SpawnPointCache::build(SpawnArea &area)
+{
+    int32_t nStep = gridStep(area);
+    area.nStep = nStep;
+
+    area.nFirstPoint = static_cast<uint32_t>(m_vPoints.size());
+    for (int32_t y = area.top; y <= area.bottom; y += nStep) {
+        for (int32_t x = area.left; x <= area.right; x += nStep) {
+            // Center of the cell, cut off by the border of the area
+            int32_t nX = std::min(x + nStep / 2, area.right);
+            int32_t nY = std::min(y + nStep / 2, area.bottom);
+            if (!GameContent::IsBlocked(nX, nY))
+                m_vPoints.emplace_back(SpawnPoint{nX, nY});
+        }
+    }
+    area.nPointCount = static_cast<uint32_t>(m_vPoints.size()) - area.nFirstPoint;
+
+    if (area.nPointCount == 0)
+        NG_LOG_WARN("server.worldserver", "Respawn area (%d, %d) - (%d, %d) has no walkable point", area.left, area.top, area.right, area.bottom);
+}
+
+uint64_t SpawnPointCache::signature() const
+{
+    // FNV-1a over everything the points are sampled from
+    uint64_t nHash = 0xcbf29ce484222325ULL;
+    auto mix = [&nHash](const void *pData, std::size_t nSize) {
+        auto pBytes = static_cast<const uint8_t *>(pData);
+        for (std::size_t i = 0; i < nSize; ++i) {
+            nHash ^= pBytes[i];
+            nHash *= 0x100000001b3ULL;
+        }
+    };
+
+    int32_t nMapWidth = sWorld.getIntConfig(CONFIG_MAP_WIDTH);
+    int32_t nMapHeight = sWorld.getIntConfig(CONFIG_MAP_HEIGHT);
+    bool bNoCollision = sWorld.getBoolConfig(CONFIG_NO_COLLISION_CHECK);
+    mix(&m_nMaxPoints, sizeof(m_nMaxPoints));
+    mix(&nMapWidth, sizeof(nMapWidth));
+    mix(&nMapHeight, sizeof(nMapHeight));
+    mix(&bNoCollision, sizeof(bNoCollision));
+    for (auto &area : m_vAreas) {
+        mix(&area.left, sizeof(area.left));
+        mix(&area.top, sizeof(area.top));
+        mix(&area.right, sizeof(area.right));
+        mix(&area.bottom, sizeof(area.bottom));
+    }
+    for (auto &polygon : sObjectMgr.g_qtBlockInfo.GetPolygons()) {
+        for (auto &p : polygon.m_Points) {
+            mix(&p.x, sizeof(p.x));
+            mix(&p.y, sizeof(p.y));
+        }
+    }
+    return nHash;
+}
+
+bool SpawnPointCache::load(const std::string &szCacheFile)
+{
+    std::ifstream infile(szCacheFile.c_str(), std::ios::in | std::ios::binary);
+    if (!infile)
+        return false;
+
+    uint32_t nMagic{0}, nVersion{0}, nAreas{0}, nPoints{0};
+    uint64_t nSignature{0};
+    infile.read(reinterpret_cast<char *>(&nMagic), sizeof(nMagic));
+    infile.read(reinterpret_cast<char *>(&nVersion), sizeof(nVersion));
+    infile.read(reinterpret_cast<char *>(&nSignature), sizeof(nSignature));
+    infile.read(reinterpret_cast<char *>(&nAreas), sizeof(nAreas));
+    if (!infile || nMagic != SPAWN_POINT_MAGIC || nVersion != SPAWN_POINT_VERSION || nSignature != signature() || nAreas != m_vAreas.size())
+        return false;
+
+    std::vector<uint32_t> vCounts(nAreas);
+    infile.read(reinterpret_cast<char *>(vCounts.data()), nAreas * sizeof(uint32_t));
+    infile.read(reinterpret_cast<char *>(&nPoints), sizeof(nPoints));
+    if (!infile)
+        return false;
+    m_vPoints.resize(nPoints);
+    infile.read(reinterpret_cast<char *>(m_vPoints.data()), nPoints * sizeof(SpawnPoint));
+    if (!infile) {
+        m_vPoints.clear();
+        return false;
+    }
+
+    uint32_t nFirstPoint = 0;
+    for (uint32_t i = 0; i < nAreas; ++i) {
+        m_vAreas[i].nFirstPoint = nFirstPoint;
+        m_vAreas[i].nPointCount = vCounts[i];
+        m_vAreas[i].nStep = gridStep(m_vAreas[i]);
+        nFirstPoint += vCounts[i];
+    }
+    if (nFirstPoint != nPoints) {
+        m_vPoints.clear();
+        return false;
+    }
+    return true;
+}
+
+void SpawnPointCache::save(const std::string &szCacheFile) const
+{
+    std::ofstream outfile(szCacheFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outfile) {
+        NG_LOG_WARN("server.worldserver", "Cannot write the spawn point cache %s, it is sampled again on the next start.", szCacheFile.c_str());
+        return;
+    }
+
+    uint32_t nAreas = static_cast<uint32_t>(m_vAreas.size());
+    uint32_t nPoints = static_cast<uint32_t>(m_vPoints.size());
+    uint64_t nSignature = signature();
+    outfile.write(reinterpret_cast<const char *>(&SPAWN_POINT_MAGIC), sizeof(SPAWN_POINT_MAGIC));
+    outfile.write(reinterpret_cast<const char *>(&SPAWN_POINT_VERSION), sizeof(SPAWN_POINT_VERSION));
+    outfile.write(reinterpret_cast<const char *>(&nSignature), sizeof(nSignature));
+    outfile.write(reinterpret_cast<const char *>(&nAreas), sizeof(nAreas));
+    for (auto &area : m_vAreas)
+        outfile.write(reinterpret_cast<const char *>(&area.nPointCount), sizeof(area.nPointCount));
+    outfile.write(reinterpret_cast<const char *>(&nPoints), sizeof(nPoints));
+    outfile.write(reinterpret_cast<const char *>(m_vPoints.data()), nPoints * sizeof(SpawnPoint));
+}
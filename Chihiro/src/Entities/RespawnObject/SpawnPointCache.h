@@ -0,0 +1,83 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <map>
+#include <tuple>
+
+#include "Common.h"
+
+struct SpawnPoint {
+    int32_t x;
+    int32_t y;
+};
+
+/// \brief Walkable points of every monster respawn area
+/// Each area is sampled on a grid once, keeping the cells whose center is not blocked, so a respawn
+/// picks one of them at random instead of retrying random points against the collision data.
+/// Large areas use a coarser grid so no area keeps more than World.SpawnPointLimit points. A respawn
+/// in a coarse cell lands on a random point of it if that is walkable and on its center otherwise,
+/// so monsters do not line up on the grid.
+///
+/// The points are written to a cache file and reused as long as the areas, the blocking
+/// polygons and the map size did not change.
+class SpawnPointCache {
+public:
+    static SpawnPointCache &Instance()
+    {
+        static SpawnPointCache instance;
+        return instance;
+    }
+
+    ~SpawnPointCache() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    SpawnPointCache(const SpawnPointCache &) = delete;
+    SpawnPointCache &operator=(const SpawnPointCache &) = delete;
+
+    /// \brief Returns the id of the area, equal rectangles share one
+    uint32_t RegisterArea(int32_t left, int32_t top, int32_t right, int32_t bottom);
+    /// \brief Loads the points of all registered areas from szCacheFile, or samples and saves them
+    void Initialize(const std::string &szCacheFile);
+
+    /// \brief Random walkable point of the area, false if it has none
+    bool GetRandomPoint(uint32_t nArea, int32_t &x, int32_t &y) const;
+
+private:
+    SpawnPointCache() = default;
+
+    struct SpawnArea {
+        int32_t left, top, right, bottom;
+        uint32_t nFirstPoint;
+        uint32_t nPointCount;
+        int32_t nStep; // grid cell size, the points are the cell centers
+    };
+
+    int32_t gridStep(const SpawnArea &area) const;
+    void build(SpawnArea &area);
+    bool load(const std::string &szCacheFile);
+    void save(const std::string &szCacheFile) const;
+    uint64_t signature() const;
+
+    bool m_bInitialized{false};
+    uint32_t m_nMaxPoints{1024};
+    std::vector<SpawnArea> m_vAreas{};
+    std::map<std::tuple<int32_t, int32_t, int32_t, int32_t>, uint32_t> m_mAreaIndex{};
+    // Points of all areas, each area owns a range of it
+    std::vector<SpawnPoint> m_vPoints{};
+};
+
+#define sSpawnPointCache SpawnPointCache::Instance()
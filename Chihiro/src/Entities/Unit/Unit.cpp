@@ -21,6 +21,7 @@
 #include <random> // std::default_random_engine
 
 #include "ClientPackets.h"
+#include "DatabaseEnv.h"
 #include "GameContent.h"
 #include "GameRule.h"
 #include "Log.h"
@@ -57,12 +58,14 @@ Unit::~Unit()
 {
     uint32_t ct = sWorld.GetArTime();
 
+    auto skillBatch = CharacterDatabase.BeginBatch(CHARACTER_REP_SKILL, CHARACTER_REP_SKILL_BATCH);
     for (auto &skill : m_vSkillList) {
-        Skill::DB_InsertSkill(this, skill->m_nSkillUID, skill->m_nSkillID, skill->m_nSkillLevel, std::max(0, static_cast<int32_t>(skill->m_nNextCoolTime - ct)));
+        Skill::DB_InsertSkill(this, skill->m_nSkillUID, skill->m_nSkillID, skill->m_nSkillLevel, std::max(0, static_cast<int32_t>(skill->m_nNextCoolTime - ct)), &skillBatch);
         delete skill;
         skill = nullptr;
     }
     m_vSkillList.clear();
+    CharacterDatabase.ExecuteBatch(skillBatch);
 
     for (auto &pState : m_vStateList) {
         pState->DeleteThis();
@@ -17,18 +17,21 @@
 
 #include "Functors.h"
 
+#include "EnterPacketEncoder.h"
+#include "InterestManager.h"
 #include "Messages.h"
 #include "Monster.h"
 #include "RegionContainer.h"
+#include "RegionSleep.h"
 #include "World.h"
 
 void SendEnterMessageEachOtherFunctor::Run(RegionType &regionType)
 {
     for (const auto &client : regionType) {
         if (client != nullptr && client->GetHandle() != obj->GetHandle()) {
-            Messages::sendEnterMessage(dynamic_cast<Player *>(client), obj, false);
+            sInterestManager.Show(dynamic_cast<Player *>(client), obj);
             if (obj->IsPlayer())
-                Messages::sendEnterMessage(dynamic_cast<Player *>(obj), client, false);
+                sInterestManager.Show(dynamic_cast<Player *>(obj), client);
             bSent = true;
         }
     }
@@ -37,15 +40,18 @@ void SendEnterMessageEachOtherFunctor::Run(RegionType &regionType)
 void SendEnterMessageFunctor::Run(RegionType &regionType)
 {
     for (const auto &client : regionType) {
-        Messages::sendEnterMessage(obj, client, false);
+        sInterestManager.Show(obj, client);
         if (obj->IsMonster()) {
             obj->As<Monster>()->m_bNearClient = true;
+            sRegionSleep.Wake(obj->As<Monster>());
         }
     }
 }
 
 void AddObjectFunctor::Run()
 {
+    // Everything the new player gets to see goes out as one buffer
+    EnterPacketEncoder::Burst burst(newObj->IsPlayer() ? newObj->As<Player>() : nullptr);
     SendEnterMessageEachOtherFunctor fn;
     fn.obj = newObj;
 
@@ -62,6 +68,8 @@ void AddObjectFunctor::Run()
 
 void AddObjectFunctor::Run2()
 {
+    // Everything the new player gets to see goes out as one buffer
+    EnterPacketEncoder::Burst burst(newObj->IsPlayer() ? newObj->As<Player>() : nullptr);
     SendEnterMessageEachOtherFunctor fn;
     fn.obj = newObj;
 
@@ -87,40 +95,3 @@ void SendMoveMessageFunctor::Run(WorldObject *client)
 {
     Messages::SendMoveMessage(dynamic_cast<Player *>(client), obj);
 }
-
-void EnumMovableObjectRegionFunctor::SubFunctor::Run(WorldObject *obj)
-{
-
-    auto c_pos = obj->GetCurrentPosition(pParent->t);
-    if (c_pos.GetPositionX() >= pParent->left && c_pos.GetPositionX() <= pParent->right && c_pos.GetPositionY() >= pParent->top && c_pos.GetPositionY() <= pParent->bottom &&
-        pParent->range > c_pos.GetExactDist2d(&pParent->pos)) {
-        pParent->pvResult.emplace_back(obj->GetHandle());
-    }
-}
-
-EnumMovableObjectRegionFunctor::EnumMovableObjectRegionFunctor(std::vector<uint32_t> &_pvResult, Position _pos, float _range, bool _bIncludeClient, bool _bIncludeNPC)
-    : pvResult(_pvResult)
-    , pos(_pos)
-    , range(_range)
-    , bIncludeClient(_bIncludeClient)
-    , bIncludeNPC(_bIncludeNPC)
-{
-    left = pos.GetPositionX() - range;
-    right = pos.GetPositionX() + range;
-    top = pos.GetPositionY() - range;
-    bottom = pos.GetPositionY() + range;
-    t = sWorld.GetArTime();
-}
-
-void EnumMovableObjectRegionFunctor::Run(Region *region)
-{
-    if (region == nullptr)
-        return;
-
-    SubFunctor fn{};
-    fn.pParent = this;
-    if (bIncludeClient)
-        region->DoEachClient(fn);
-    if (bIncludeNPC)
-        region->DoEachMovableObject(fn);
-}
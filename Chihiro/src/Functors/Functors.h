@@ -119,30 +119,3 @@ struct SetMoveFunctor : public RegionFunctor {
     Unit *obj{nullptr};
     void Run(Region *region) override;
 };
-
-struct EnumMovableObjectRegionFunctor : public RegionFunctor {
-    std::vector<uint32_t> &pvResult;
-    uint32_t t;
-    Position pos;
-    float left;
-    float right;
-    float top;
-    float bottom;
-    float range;
-    bool bIncludeClient;
-    bool bIncludeNPC;
-
-    struct SubFunctor : public WorldObjectFunctor {
-        SubFunctor()
-            : pParent(nullptr)
-        {
-        }
-
-        void Run(WorldObject *obj) override;
-
-        EnumMovableObjectRegionFunctor *pParent;
-    };
-
-    EnumMovableObjectRegionFunctor(std::vector<uint32_t> &_pvResult, Position _pos, float _range, bool _bIncludeClient, bool _bIncludeNPC);
-    void Run(Region *region) override;
-};
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "GameContent.h"
 
 #include "FieldPropManager.h"
+#include "LineOfSight.h"
 #include "Maploader.h"
 #include "MemPool.h"
 #include "NPC.h"
@@ -38,7 +39,12 @@ bool GameContent::IsBlocked(float x, float y)
 
 bool GameContent::CollisionToLine(float x1, float y1, float x2, float y2)
 {
-    return sObjectMgr.g_qtBlockInfo.m_MasterNode.LooseCollision({{x1, y1}, {x2, y2}});
+    return sLineOfSight.CollisionToLine(x1, y1, x2, y2);
+}
+
+void GameContent::CollisionToLines(float x, float y, const float *pX, const float *pY, uint8_t *pBlocked, std::size_t nCount)
+{
+    sLineOfSight.CollisionToLines(x, y, pX, pY, pBlocked, nCount);
 }
 
 bool GameContent::LearnAllSkill(Unit *pUnit)
@@ -315,6 +321,9 @@ uint16_t GameContent::isLearnableSkill(Unit *pUnit, int32_t skill_id, int32_t sk
 
 int32_t GameContent::GetLocationID(const float x, const float y)
 {
+    if (sMapContent.m_LocationGrid.IsReady())
+        return sMapContent.m_LocationGrid.GetLocationID(x, y);
+
     int32_t loc_id = 0;
     int32_t priority = 0x7fffffff;
     X2D::Pointf pt{};
@@ -36,6 +36,7 @@ public:
     static int32_t GetLocationID(float x, float y);
     static bool IsBlocked(float x, float y);
     static bool CollisionToLine(float x1, float y1, float x2, float y2);
+    static void CollisionToLines(float x, float y, const float *pX, const float *pY, uint8_t *pBlocked, std::size_t nCount);
     static NPC *GetNewNPC(NPCTemplate *npc_info, uint8_t layer);
     static void AddNPCToWorld();
     static int64_t GetItemSellPrice(int64_t price, int32_t rank, int32_t lv, bool same_price_for_buying);
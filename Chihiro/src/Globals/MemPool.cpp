@@ -19,7 +19,11 @@
 
 #include "FieldPropManager.h"
 #include "ItemCollector.h"
+#include "Metrics.h"
 #include "ObjectMgr.h"
+#include "RegionSleep.h"
+#include "TickProfiler.h"
+#include "TickScheduler.h"
 #include "World.h"
 
 template class HashMapHolder<Player>;
@@ -119,50 +123,108 @@ void MemoryPoolMgr::Update(uint32_t diff)
     while (addUpdateQueue.next(sess))
         i_objectsToUpdate[sess->GetHandle()] = sess;
 
-    for (UpdateMap::iterator itr = i_objectsToUpdate.begin(), next; itr != i_objectsToUpdate.end(); itr = next) {
-        next = itr;
-        ++next;
-
-        if (itr->second->IsWorldObject())
-            reinterpret_cast<WorldObject *>(itr->second)->Update(0);
+    ///- Monsters woken up since the last tick are updated again
+    std::vector<Monster *> vWoken{};
+    sRegionSleep.TakeWoken(vWoken);
+    for (auto pMonster : vWoken) {
+        pMonster->OnWake();
+        i_objectsToUpdate[pMonster->GetHandle()] = pMonster;
+    }
 
-        if (itr->second->IsDeleteRequested()) {
-            AddToDeleteList(itr->second);
-            i_objectsToUpdate.erase(itr->second->GetHandle());
-            continue;
+    {
+        TickZone zone(TP_OBJECTS);
+        bool bProfile = sTickProfiler.IsEnabled();
+        bool bSleepTick = sRegionSleep.IsSleepTick();
+        for (UpdateMap::iterator itr = i_objectsToUpdate.begin(), next; itr != i_objectsToUpdate.end(); itr = next) {
+            next = itr;
+            ++next;
+
+            // Idle monsters no player can see leave the list until one comes close
+            if (bSleepTick && itr->second->IsMonster()) {
+                auto pMonster = itr->second->As<Monster>();
+                if (pMonster->CanSleep() && !sRegionSleep.IsAwake(pMonster)) {
+                    sRegionSleep.Sleep(pMonster);
+                    i_objectsToUpdate.erase(itr);
+                    continue;
+                }
+            }
+
+            if (itr->second->IsWorldObject()) {
+                if (bProfile) {
+                    auto tStart = std::chrono::steady_clock::now();
+                    reinterpret_cast<WorldObject *>(itr->second)->Update(0);
+                    sTickProfiler.AddEntity(itr->first, itr->second->GetSubType(),
+                        static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tStart).count()));
+                }
+                else {
+                    reinterpret_cast<WorldObject *>(itr->second)->Update(0);
+                }
+            }
+
+            if (itr->second->IsDeleteRequested()) {
+                AddToDeleteList(itr->second);
+                i_objectsToUpdate.erase(itr->second->GetHandle());
+                continue;
+            }
         }
     }
-    // First deleting all things in the remove list
-    while (!i_objectsToRemove.empty()) {
-        auto itr = i_objectsToRemove.begin();
-        Object *obj = *itr;
-
-        if (obj->IsWorldObject() && obj->IsInWorld())
-            sWorld.RemoveObjectFromWorld(obj->As<WorldObject>());
-
-        switch (obj->GetSubType()) {
-        case ST_Player:
-            RemoveObject(obj->As<Player>());
-            break;
-        case ST_Mob:
-            RemoveObject(obj->As<Monster>());
-            break;
-        case ST_Summon:
-            RemoveObject(obj->As<Summon>());
-            break;
-        case ST_Object: // In this case item
-            RemoveObject(obj->As<Item>());
-            break;
-        default:
-            RemoveObject(obj);
-            break;
+    {
+        TickZone zone(TP_OBJECT_REMOVAL);
+        // First deleting all things in the remove list
+        while (!i_objectsToRemove.empty()) {
+            auto itr = i_objectsToRemove.begin();
+            Object *obj = *itr;
+
+            if (obj->IsWorldObject() && obj->IsInWorld())
+                sWorld.RemoveObjectFromWorld(obj->As<WorldObject>());
+
+            switch (obj->GetSubType()) {
+            case ST_Player:
+                RemoveObject(obj->As<Player>());
+                break;
+            case ST_Mob:
+                RemoveObject(obj->As<Monster>());
+                break;
+            case ST_Summon:
+                RemoveObject(obj->As<Summon>());
+                break;
+            case ST_Object: // In this case item
+                RemoveObject(obj->As<Item>());
+                break;
+            default:
+                RemoveObject(obj);
+                break;
+            }
+            i_objectsToRemove.erase(itr);
+            delete obj;
+            //*&obj = nullptr;
         }
-        i_objectsToRemove.erase(itr);
-        delete obj;
-        //*&obj = nullptr;
     }
-    sFieldPropManager.Update(diff);
-    sItemCollector.Update();
+    {
+        TickZone zone(TP_FIELD_PROPS);
+        sFieldPropManager.Update(diff);
+    }
+    {
+        TickZone zone(TP_ITEM_COLLECTOR);
+        // Expired items can lie on the ground a few ticks longer when the world is busy
+        if (!sTickScheduler.IsDeferred(0))
+            sItemCollector.Update();
+    }
+
+    static auto &playerCount = sMetrics.GetGauge("pool.players");
+    static auto &monsterCount = sMetrics.GetGauge("pool.monsters");
+    static auto &summonCount = sMetrics.GetGauge("pool.summons");
+    static auto &itemCount = sMetrics.GetGauge("pool.items");
+    static auto &objectCount = sMetrics.GetGauge("pool.objects");
+    static auto &updateCount = sMetrics.GetGauge("pool.update_list");
+    static auto &sleepingCount = sMetrics.GetGauge("pool.sleeping");
+    playerCount.Set(static_cast<int64_t>(HashMapHolder<Player>::Size()));
+    monsterCount.Set(static_cast<int64_t>(HashMapHolder<Monster>::Size()));
+    summonCount.Set(static_cast<int64_t>(HashMapHolder<Summon>::Size()));
+    itemCount.Set(static_cast<int64_t>(HashMapHolder<Item>::Size()));
+    objectCount.Set(static_cast<int64_t>(HashMapHolder<Object>::Size()));
+    updateCount.Set(static_cast<int64_t>(i_objectsToUpdate.size()));
+    sleepingCount.Set(static_cast<int64_t>(sRegionSleep.GetSleepingCount()));
 }
 
 Item *MemoryPoolMgr::AllocGold(int64_t gold, GenerateCode gcode)
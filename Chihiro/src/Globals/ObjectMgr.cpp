@@ -93,104 +93,96 @@ void ObjectMgr::LoadItemResource()
 {
     uint32_t oldMSTime = getMSTime();
 
-    QueryResult result = GameDatabase.Query("SELECT id, type, `group`, class, wear_type, set_id, set_part_flag, rank, level,"
-                                            "enhance, socket, status_flag, limit_deva, limit_asura, limit_gaia, limit_fighter,"
-                                            "limit_hunter, limit_magician, limit_summoner, use_min_level, use_max_level, target_min_level,"
-                                            "target_max_level, `range`, weight, price, endurance, material, summon_id, flag_cashitem,"
-                                            "flag_wear, flag_use, flag_target_use, flag_duplicate, flag_drop, flag_trade, flag_sell,"
-                                            "flag_storage, flag_overweight, flag_riding, flag_move, flag_sit, flag_enhance, flag_quest,"
-                                            "flag_raid, flag_secroute, flag_eventmap, flag_huntaholic, available_period, decrease_type,"
-                                            "throw_range, distribute_type, base_type_0, base_var1_0, base_var2_0, base_type_1, base_var1_1,"
-                                            "base_var2_1, base_type_2, base_var1_2, base_var2_2, base_type_3, base_var1_3, base_var2_3, "
-                                            "opt_type_0, opt_var1_0, opt_var2_0, opt_type_1, opt_var1_1, opt_var2_1, opt_type_2,"
-                                            "opt_var1_2, opt_var2_2, opt_type_3, opt_var1_3, opt_var2_3, enhance_0_id, enhance_0_01,"
-                                            "enhance_0_02, enhance_0_03, enhance_0_04, enhance_1_id, enhance_1_01, enhance_1_02,"
-                                            "enhance_1_03, enhance_1_04, skill_id, state_id, state_level, state_time, state_type, cool_time, "
-                                            "cool_time_group, script_text, name_id FROM ItemResource;");
-
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Items. Table `ItemResource` is empty!");
-        return;
-    }
-
-    uint32_t count = 0;
-    do {
-        Field *fields = result->Fetch();
-        auto itemTemplate = std::make_shared<ItemTemplate>();
-
-        itemTemplate->nID = fields[0].GetInt32();
-        itemTemplate->eType = static_cast<ItemType>(fields[1].GetInt32());
-        itemTemplate->eGroup = static_cast<ItemGroup>(fields[2].GetInt32());
-        itemTemplate->eClass = static_cast<ItemClass>(fields[3].GetInt32());
-        itemTemplate->eWearType = static_cast<ItemWearType>(fields[4].GetInt32());
-        itemTemplate->set_id = fields[5].GetInt32();
-        itemTemplate->set_part_flag = fields[6].GetInt32();
-        itemTemplate->rank = fields[7].GetInt32();
-        itemTemplate->level = fields[8].GetInt32();
-        itemTemplate->enhance = fields[9].GetInt32();
-        itemTemplate->socket = fields[10].GetInt32();
-        itemTemplate->status_flag = fields[11].GetInt32();
-        itemTemplate->limit_deva = fields[12].GetInt32();
-        itemTemplate->limit_asura = fields[13].GetInt32();
-        itemTemplate->limit_gaia = fields[14].GetInt32();
-        itemTemplate->limit_fighter = fields[15].GetInt32();
-        itemTemplate->limit_hunter = fields[16].GetInt32();
-        itemTemplate->limit_magician = fields[17].GetInt32();
-        itemTemplate->limit_summoner = fields[18].GetInt32();
-        itemTemplate->use_min_level = fields[19].GetInt32();
-        itemTemplate->use_max_level = fields[20].GetInt32();
-        itemTemplate->target_min_level = fields[21].GetInt32();
-        itemTemplate->target_max_level = fields[22].GetInt32();
-        itemTemplate->range = fields[23].GetFloat() * 100;
-        itemTemplate->weight = fields[24].GetFloat();
-        itemTemplate->price = fields[25].GetUInt32();
-        itemTemplate->endurance = fields[26].GetInt32();
-        itemTemplate->material = fields[27].GetInt32();
-        itemTemplate->summon_id = fields[28].GetInt32();
-        for (int32_t i = 0; i < 19; i++) {
-            itemTemplate->flaglist[i] = fields[29 + i].GetUInt8();
-        }
-        itemTemplate->available_period = fields[48].GetInt32();
-        itemTemplate->decrease_type = fields[49].GetInt16();
-        itemTemplate->throw_range = fields[50].GetFloat();
-        itemTemplate->distribute_type = fields[51].GetUInt8();
-        int32_t y = 52;
+    static RowBinding<ItemTemplate> const binding = [] {
+        RowBinding<ItemTemplate> item;
+        item.Column(&ItemTemplate::nID)
+            .Column(&ItemTemplate::eType)
+            .Column(&ItemTemplate::eGroup)
+            .Column(&ItemTemplate::eClass)
+            .Column(&ItemTemplate::eWearType)
+            .Column(&ItemTemplate::set_id)
+            .Column(&ItemTemplate::set_part_flag)
+            .Column(&ItemTemplate::rank)
+            .Column(&ItemTemplate::level)
+            .Column(&ItemTemplate::enhance)
+            .Column(&ItemTemplate::socket)
+            .Column(&ItemTemplate::status_flag)
+            .Column(&ItemTemplate::limit_deva)
+            .Column(&ItemTemplate::limit_asura)
+            .Column(&ItemTemplate::limit_gaia)
+            .Column(&ItemTemplate::limit_fighter)
+            .Column(&ItemTemplate::limit_hunter)
+            .Column(&ItemTemplate::limit_magician)
+            .Column(&ItemTemplate::limit_summoner)
+            .Column(&ItemTemplate::use_min_level)
+            .Column(&ItemTemplate::use_max_level)
+            .Column(&ItemTemplate::target_min_level)
+            .Column(&ItemTemplate::target_max_level)
+            .Column(&ItemTemplate::range)
+            .Column(&ItemTemplate::weight)
+            .Column(&ItemTemplate::price)
+            .Column(&ItemTemplate::endurance)
+            .Column(&ItemTemplate::material)
+            .Column(&ItemTemplate::summon_id)
+            .Column(&ItemTemplate::flaglist)
+            .Column(&ItemTemplate::available_period)
+            .Column(&ItemTemplate::decrease_type)
+            .Column(&ItemTemplate::throw_range)
+            .Column(&ItemTemplate::distribute_type);
         for (int32_t i = 0; i < 4; i++) {
-            itemTemplate->base_type[i] = fields[y++].GetInt16();
-            itemTemplate->base_var[i][0] = fields[y++].GetFloat();
-            itemTemplate->base_var[i][1] = fields[y++].GetFloat();
+            item.Element([i](ItemTemplate &row) -> auto & { return row.base_type[i]; }).Element([i](ItemTemplate &row) -> auto & { return row.base_var[i]; });
         }
-        y = 64;
         for (int32_t i = 0; i < 4; i++) {
-            itemTemplate->opt_type[i] = fields[y++].GetInt16();
-            itemTemplate->opt_var[i][0] = fields[y++].GetFloat();
-            itemTemplate->opt_var[i][1] = fields[y++].GetFloat();
+            item.Element([i](ItemTemplate &row) -> auto & { return row.opt_type[i]; }).Element([i](ItemTemplate &row) -> auto & { return row.opt_var[i]; });
         }
-        y = 76;
         for (int32_t i = 0; i < 2; i++) {
-            itemTemplate->enhance_id[i] = fields[y++].GetInt16();
-            itemTemplate->_enhance[i][0] = fields[y++].GetFloat();
-            itemTemplate->_enhance[i][1] = fields[y++].GetFloat();
-            itemTemplate->_enhance[i][2] = fields[y++].GetFloat();
-            itemTemplate->_enhance[i][3] = fields[y++].GetFloat();
+            item.Element([i](ItemTemplate &row) -> auto & { return row.enhance_id[i]; }).Element([i](ItemTemplate &row) -> auto & { return row._enhance[i]; });
         }
+        item.Column(&ItemTemplate::skill_id)
+            .Column(&ItemTemplate::state_id)
+            .Column(&ItemTemplate::state_level)
+            .Column(&ItemTemplate::state_time)
+            .Column(&ItemTemplate::state_type)
+            .Column(&ItemTemplate::cool_time)
+            .Column(&ItemTemplate::cool_time_group)
+            .Column(&ItemTemplate::script_text)
+            .Column(&ItemTemplate::nNameID);
+        return item;
+    }();
+
+    RowReader<ItemTemplate> reader(GameDatabase.StreamQuery("SELECT id, type, `group`, class, wear_type, set_id, set_part_flag, rank, level,"
+                                                            "enhance, socket, status_flag, limit_deva, limit_asura, limit_gaia, limit_fighter,"
+                                                            "limit_hunter, limit_magician, limit_summoner, use_min_level, use_max_level, target_min_level,"
+                                                            "target_max_level, `range`, weight, price, endurance, material, summon_id, flag_cashitem,"
+                                                            "flag_wear, flag_use, flag_target_use, flag_duplicate, flag_drop, flag_trade, flag_sell,"
+                                                            "flag_storage, flag_overweight, flag_riding, flag_move, flag_sit, flag_enhance, flag_quest,"
+                                                            "flag_raid, flag_secroute, flag_eventmap, flag_huntaholic, available_period, decrease_type,"
+                                                            "throw_range, distribute_type, base_type_0, base_var1_0, base_var2_0, base_type_1, base_var1_1,"
+                                                            "base_var2_1, base_type_2, base_var1_2, base_var2_2, base_type_3, base_var1_3, base_var2_3, "
+                                                            "opt_type_0, opt_var1_0, opt_var2_0, opt_type_1, opt_var1_1, opt_var2_1, opt_type_2,"
+                                                            "opt_var1_2, opt_var2_2, opt_type_3, opt_var1_3, opt_var2_3, enhance_0_id, enhance_0_01,"
+                                                            "enhance_0_02, enhance_0_03, enhance_0_04, enhance_1_id, enhance_1_01, enhance_1_02,"
+                                                            "enhance_1_03, enhance_1_04, skill_id, state_id, state_level, state_time, state_type, cool_time, "
+                                                            "cool_time_group, script_text, name_id FROM ItemResource;"),
+        binding);
 
-        itemTemplate->skill_id = fields[86].GetInt32();
-        itemTemplate->state_id = fields[87].GetInt32();
-        itemTemplate->state_level = fields[88].GetInt32();
-        itemTemplate->state_time = fields[89].GetInt32();
-        itemTemplate->state_type = fields[90].GetInt32();
-        itemTemplate->cool_time = fields[91].GetInt32();
-        itemTemplate->cool_time_group = fields[92].GetInt16();
-        itemTemplate->script_text = fields[93].GetString();
-        itemTemplate->nNameID = fields[94].GetInt32();
-
+    uint32_t count = 0;
+    ItemTemplate row{};
+    while (reader.Next(row)) {
+        // nLimit is not bound and stays zero in row
+        auto itemTemplate = std::make_shared<ItemTemplate>(row);
+        itemTemplate->range *= 100;
         itemTemplate->SetCombinedFlags();
 
         _itemTemplateStore[itemTemplate->nID] = itemTemplate;
 
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Items. Table `ItemResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Items in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -198,90 +190,101 @@ void ObjectMgr::LoadItemResource()
 void ObjectMgr::LoadMonsterResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM MonsterResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Monstertemplates. Table `MonsterResource` is empty!");
-        return;
-    }
 
-    uint32_t count = 0, y = 0;
-    do {
-        Field *field = result->Fetch();
-        int32_t idx = 0;
-        MonsterBase base{};
-        base.id = field[idx++].GetInt32();
-        base.monster_group = field[idx++].GetInt32();
-        base.name_id = field[idx++].GetInt32();
-        base.location_id = field[idx++].GetInt32();
-        idx += 5; // 14 unused columns, mostly for rendering clientside
-        base.size = field[idx++].GetFloat();
-        base.scale = field[idx++].GetFloat();
-        idx += 7;
-        base.level = field[idx++].GetInt32();
-        base.grp = field[idx++].GetInt32();
-        base.magic_type = field[idx++].GetInt32();
-        base.race = field[idx++].GetInt32();
-        base.visible_range = field[idx++].GetInt32() * 12;
-        base.chase_range = field[idx++].GetInt32();
-        for (auto &curr : base.flag) {
-            curr = field[idx++].GetInt32();
-        }
-        base.monster_type = field[idx++].GetInt32();
-        base.stat_id = field[idx++].GetInt32();
-        base.fight_type = field[idx++].GetInt32();
-        idx += 9;
-        base.weapon_type = field[idx++].GetInt32();
-        base.attack_motion_speed = field[idx++].GetInt32();
-        base.ability = field[idx++].GetInt32();
-        base.standard_walk_speed = field[idx++].GetInt32();
-        base.standard_run_speed = field[idx++].GetInt32();
-        base.walk_speed = field[idx++].GetInt32();
-        base.run_speed = field[idx++].GetInt32();
-        base.attack_range = field[idx++].GetFloat() * 100;
-        base.hp = field[idx++].GetInt32();
-        base.mp = field[idx++].GetInt32();
-        base.attacK_point = field[idx++].GetInt32();
-        base.magic_point = field[idx++].GetInt32();
-        base.defence = field[idx++].GetInt32();
-        base.magic_defence = field[idx++].GetInt32();
-        base.attack_speed = field[idx++].GetInt32();
-        base.magic_speed = field[idx++].GetInt32();
-        base.accuracy = field[idx++].GetInt32();
-        base.magic_accuracy = field[idx++].GetInt32();
-        base.avoid = field[idx++].GetInt32();
-        base.magic_avoid = field[idx++].GetInt32();
-        base.taming_id = field[idx++].GetInt32();
-        base.taming_percentage = field[idx++].GetFloat();
-        base.taming_exp_mod = field[idx++].GetFloat();
-        for (y = 0; y < 2; y++) {
-            base.exp[y] = field[idx++].GetInt32();
-            base.jp[y] = field[idx++].GetInt32();
+    //! drop_percentage is stored as a ratio, it is scaled to an integer after the row is read
+    struct MonsterResourceRow : MonsterBase {
+        float drop_ratio[10];
+    };
+
+    static RowBinding<MonsterResourceRow> const binding = [] {
+        RowBinding<MonsterResourceRow> monster;
+        monster.Column(&MonsterBase::id)
+            .Column(&MonsterBase::monster_group)
+            .Column(&MonsterBase::name_id)
+            .Column(&MonsterBase::location_id)
+            .Skip(5) // 14 unused columns, mostly for rendering clientside
+            .Column(&MonsterBase::size)
+            .Column(&MonsterBase::scale)
+            .Skip(7)
+            .Column(&MonsterBase::level)
+            .Column(&MonsterBase::grp)
+            .Column(&MonsterBase::magic_type)
+            .Column(&MonsterBase::race)
+            .Column(&MonsterBase::visible_range)
+            .Column(&MonsterBase::chase_range)
+            .Column(&MonsterBase::flag)
+            .Column(&MonsterBase::monster_type)
+            .Column(&MonsterBase::stat_id)
+            .Column(&MonsterBase::fight_type)
+            .Skip(9)
+            .Column(&MonsterBase::weapon_type)
+            .Column(&MonsterBase::attack_motion_speed)
+            .Column(&MonsterBase::ability)
+            .Column(&MonsterBase::standard_walk_speed)
+            .Column(&MonsterBase::standard_run_speed)
+            .Column(&MonsterBase::walk_speed)
+            .Column(&MonsterBase::run_speed)
+            .Column(&MonsterBase::attack_range)
+            .Column(&MonsterBase::hp)
+            .Column(&MonsterBase::mp)
+            .Column(&MonsterBase::attacK_point)
+            .Column(&MonsterBase::magic_point)
+            .Column(&MonsterBase::defence)
+            .Column(&MonsterBase::magic_defence)
+            .Column(&MonsterBase::attack_speed)
+            .Column(&MonsterBase::magic_speed)
+            .Column(&MonsterBase::accuracy)
+            .Column(&MonsterBase::magic_accuracy)
+            .Column(&MonsterBase::avoid)
+            .Column(&MonsterBase::magic_avoid)
+            .Column(&MonsterBase::taming_id)
+            .Column(&MonsterBase::taming_percentage)
+            .Column(&MonsterBase::taming_exp_mod);
+        for (int32_t y = 0; y < 2; y++) {
+            monster.Element([y](MonsterResourceRow &row) -> auto & { return row.exp[y]; }).Element([y](MonsterResourceRow &row) -> auto & { return row.jp[y]; });
             if (y == 0)
-                base.gold_drop_percentage = field[idx++].GetInt32();
-            base.gold_min[y] = field[idx++].GetInt32();
-            base.gold_max[y] = field[idx++].GetInt32();
+                monster.Column(&MonsterBase::gold_drop_percentage);
+            monster.Element([y](MonsterResourceRow &row) -> auto & { return row.gold_min[y]; }).Element([y](MonsterResourceRow &row) -> auto & { return row.gold_max[y]; });
             if (y == 0)
-                base.chaos_drop_percentage = field[idx++].GetInt32();
-            base.chaos_min[y] = field[idx++].GetInt32();
-            base.chaos_max[y] = field[idx++].GetInt32();
+                monster.Column(&MonsterBase::chaos_drop_percentage);
+            monster.Element([y](MonsterResourceRow &row) -> auto & { return row.chaos_min[y]; }).Element([y](MonsterResourceRow &row) -> auto & { return row.chaos_max[y]; });
+        }
+        for (int32_t y = 0; y < 10; y++) {
+            monster.Element([y](MonsterResourceRow &row) -> auto & { return row.drop_item_id[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.drop_ratio[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.drop_min_count[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.drop_max_count[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.drop_min_level[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.drop_max_level[y]; });
         }
-        for (y = 0; y < 10; y++) {
-            base.drop_item_id[y] = field[idx++].GetInt32();
-            base.drop_percentage[y] = (int32_t)(field[idx++].GetFloat() * 100000000);
-            base.drop_min_count[y] = field[idx++].GetInt32();
-            base.drop_max_count[y] = field[idx++].GetInt32();
-            base.drop_min_level[y] = field[idx++].GetInt32();
-            base.drop_max_level[y] = field[idx++].GetInt32();
+        for (int32_t y = 0; y < 4; y++) {
+            monster.Element([y](MonsterResourceRow &row) -> auto & { return row.skill_id[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.skill_lv[y]; })
+                .Element([y](MonsterResourceRow &row) -> auto & { return row.skill_probability[y]; });
         }
-        for (y = 0; y < 4; y++) {
-            base.skill_id[y] = field[idx++].GetInt32();
-            base.skill_lv[y] = field[idx++].GetInt32();
-            base.skill_probability[y] = field[idx++].GetFloat();
+        monster.Column(&MonsterBase::local_flag);
+        return monster;
+    }();
+
+    RowReader<MonsterResourceRow> reader(GameDatabase.StreamQuery("SELECT * FROM MonsterResource;"), binding);
+
+    uint32_t count = 0;
+    MonsterResourceRow row{};
+    while (reader.Next(row)) {
+        MonsterBase base = row;
+        base.visible_range *= 12;
+        base.attack_range *= 100;
+        for (int32_t y = 0; y < 10; y++) {
+            base.drop_percentage[y] = (int32_t)(row.drop_ratio[y] * 100000000);
         }
-        base.local_flag = field[idx].GetInt32();
         _monsterBaseStore[base.id] = base;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Monstertemplates. Table `MonsterResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Monstertemplates in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -289,88 +292,97 @@ void ObjectMgr::LoadMonsterResource()
 void ObjectMgr::LoadQuestResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM QuestResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Quests. Table `QuestResource` is empty!");
-        return;
-    }
-
-    uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        int32_t idx = 0;
 
-        QuestBaseServer q{};
-        q.nCode = field[idx++].GetInt32();
-        q.nQuestTextID = field[idx++].GetInt32();
-        q.nSummaryTextID = field[idx++].GetInt32();
-        q.nStatusTextID = field[idx++].GetInt32();
-        q.nLimitLevel = field[idx++].GetInt32();
-        q.nLimitJobLevel = field[idx++].GetInt32();
-        q.nLimitIndication = field[idx++].GetUInt8();
-
-        int32_t limit_deva = field[idx++].GetInt32();
-        int32_t limit_asura = field[idx++].GetInt32();
-        int32_t limit_gaia = field[idx++].GetInt32();
-
-        int32_t limit_fighter = field[idx++].GetInt32();
-        int32_t limit_hunter = field[idx++].GetInt32();
-        int32_t limit_magician = field[idx++].GetInt32();
-        int32_t limit_summoner = field[idx++].GetInt32();
-
-        q.nLimitJob = field[idx++].GetInt32();
-        q.nLimitFavorGroupID = field[idx++].GetInt32();
-        q.nLimitFavor = field[idx++].GetInt32();
-        q.bIsRepeatable = field[idx++].GetUInt8() == 1;
-        q.nInvokeCondition = field[idx++].GetInt32();
-        q.nInvokeValue = field[idx++].GetInt32();
-        q.nType = (QuestType)field[idx++].GetInt32();
-        for (int32_t &i : q.nValue) {
-            i = field[idx++].GetInt32();
-        }
-        q.nDropGroupID = field[idx++].GetInt32();
-        q.nQuestDifficulty = field[idx++].GetInt32();
-        q.nFavorGroupID = field[idx++].GetInt32();
-        q.nHateGroupID = field[idx++].GetInt32();
-        q.nFavor = field[idx++].GetInt32();
-        q.nEXP = field[idx++].GetUInt64();
-        q.nJP = field[idx++].GetInt32();
-        q.nGold = field[idx++].GetInt64();
-        q.DefaultReward.nItemCode = field[idx++].GetInt32();
-        q.DefaultReward.nLevel = field[idx++].GetInt32();
-        q.DefaultReward.nQuantity = field[idx++].GetInt32();
-        for (auto &i : q.OptionalReward) {
-            i.nItemCode = field[idx++].GetInt32();
-            i.nLevel = field[idx++].GetInt32();
-            i.nQuantity = field[idx++].GetInt32();
-        }
-        for (int32_t &i : q.nForeQuest) {
-            i = field[idx++].GetInt32();
+    //! The race and job limits are folded into LimitFlag after the row is read
+    struct QuestResourceRow : QuestBaseServer {
+        int32_t limit_deva;
+        int32_t limit_asura;
+        int32_t limit_gaia;
+        int32_t limit_fighter;
+        int32_t limit_hunter;
+        int32_t limit_magician;
+        int32_t limit_summoner;
+    };
+
+    static RowBinding<QuestResourceRow> const binding = [] {
+        RowBinding<QuestResourceRow> quest;
+        quest.Column(&QuestBase::nCode)
+            .Column(&QuestBase::nQuestTextID)
+            .Column(&QuestBase::nSummaryTextID)
+            .Column(&QuestBase::nStatusTextID)
+            .Column(&QuestBase::nLimitLevel)
+            .Column(&QuestBase::nLimitJobLevel)
+            .Column(&QuestBase::nLimitIndication)
+            .Column(&QuestResourceRow::limit_deva)
+            .Column(&QuestResourceRow::limit_asura)
+            .Column(&QuestResourceRow::limit_gaia)
+            .Column(&QuestResourceRow::limit_fighter)
+            .Column(&QuestResourceRow::limit_hunter)
+            .Column(&QuestResourceRow::limit_magician)
+            .Column(&QuestResourceRow::limit_summoner)
+            .Column(&QuestBase::nLimitJob)
+            .Column(&QuestBaseServer::nLimitFavorGroupID)
+            .Column(&QuestBase::nLimitFavor)
+            .Column(&QuestBase::bIsRepeatable)
+            .Column(&QuestBase::nInvokeCondition)
+            .Column(&QuestBase::nInvokeValue)
+            .Column(&QuestBase::nType)
+            .Column(&QuestBase::nValue)
+            .Column(&QuestBase::nDropGroupID)
+            .Column(&QuestBase::nQuestDifficulty)
+            .Column(&QuestBaseServer::nFavorGroupID)
+            .Column(&QuestBaseServer::nHateGroupID)
+            .Column(&QuestBase::nFavor)
+            .Column(&QuestBase::nEXP)
+            .Column(&QuestBase::nJP)
+            .Column(&QuestBase::nGold)
+            .Element([](QuestResourceRow &row) -> auto & { return row.DefaultReward.nItemCode; })
+            .Element([](QuestResourceRow &row) -> auto & { return row.DefaultReward.nLevel; })
+            .Element([](QuestResourceRow &row) -> auto & { return row.DefaultReward.nQuantity; });
+        for (int32_t i = 0; i < MAX_OPTIONAL_REWARD; i++) {
+            quest.Element([i](QuestResourceRow &row) -> auto & { return row.OptionalReward[i].nItemCode; })
+                .Element([i](QuestResourceRow &row) -> auto & { return row.OptionalReward[i].nLevel; })
+                .Element([i](QuestResourceRow &row) -> auto & { return row.OptionalReward[i].nQuantity; });
         }
-        q.bForceCheckType = field[idx++].GetUInt8() != 0;
-        q.strAcceptScript = field[idx++].GetString();
-        q.strClearScript = field[idx++].GetString();
-        q.strScript = field[idx].GetString();
+        quest.Column(&QuestBase::nForeQuest)
+            .Column(&QuestBase::bForceCheckType)
+            .Column(&QuestBaseServer::strAcceptScript)
+            .Column(&QuestBaseServer::strClearScript)
+            .Column(&QuestBaseServer::strScript);
+        return quest;
+    }();
 
-        if (limit_asura != 0)
+    RowReader<QuestResourceRow> reader(GameDatabase.StreamQuery("SELECT * FROM QuestResource;"), binding);
+
+    uint32_t count = 0;
+    QuestResourceRow row{};
+    while (reader.Next(row)) {
+        QuestBaseServer q = row;
+        q.LimitFlag = 0;
+        if (row.limit_asura != 0)
             q.LimitFlag |= 4;
-        if (limit_gaia != 0)
+        if (row.limit_gaia != 0)
             q.LimitFlag |= 8u;
-        if (limit_deva != 0)
+        if (row.limit_deva != 0)
             q.LimitFlag |= 2u;
-        if (limit_hunter != 0)
+        if (row.limit_hunter != 0)
             q.LimitFlag |= 0x20u;
-        if (limit_fighter != 0)
+        if (row.limit_fighter != 0)
             q.LimitFlag |= 0x10u;
-        if (limit_magician != 0)
+        if (row.limit_magician != 0)
             q.LimitFlag |= 0x40u;
-        if (limit_summoner != 0)
+        if (row.limit_summoner != 0)
             q.LimitFlag |= 0x80u;
 
         _questTemplateStore[q.nCode] = q;
 
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Quests. Table `QuestResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Quests in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -486,25 +498,32 @@ void ObjectMgr::LoadQuestLinkResource()
 void ObjectMgr::LoadDropGroupResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM DropGroupResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 DropGroups. Table `DropGroupResource` is empty!");
-        return;
-    }
 
-    uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        int32_t idx = 0;
-        DropGroup dg{};
-        dg.uid = field[idx++].GetInt32();
+    static RowBinding<DropGroup> const binding = [] {
+        RowBinding<DropGroup> dropGroup;
+        dropGroup.Column(&DropGroup::uid);
         for (int32_t i = 0; i < MAX_DROP_GROUP; i++) {
-            dg.drop_item_id[i] = field[idx++].GetInt32();
-            dg.drop_percentage[i] = (int32_t)(field[idx++].GetFloat() * 100000000);
+            dropGroup.Element([i](DropGroup &row) -> auto & { return row.drop_item_id[i]; }).Element([i](DropGroup &row) -> auto & { return row.drop_percentage[i]; });
+        }
+        return dropGroup;
+    }();
+
+    RowReader<DropGroup> reader(GameDatabase.StreamQuery("SELECT * FROM DropGroupResource;"), binding);
+
+    uint32_t count = 0;
+    DropGroup dg{};
+    while (reader.Next(dg)) {
+        for (float &percentage : dg.drop_percentage) {
+            percentage = (int32_t)(percentage * 100000000);
         }
         _dropTemplateStore[dg.uid] = dg;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 DropGroups. Table `DropGroupResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u DropGroups in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -512,31 +531,35 @@ void ObjectMgr::LoadDropGroupResource()
 void ObjectMgr::LoadSkillTreeResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM SkillTreeResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Skilltrees. Table `SkillTreeResource` is empty!");
-        return;
-    }
 
-    uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        int32_t idx = 0;
-        SkillTreeBase base{};
-        base.job_id = field[idx++].GetInt32();
-        base.skill_id = field[idx++].GetInt32();
-        base.min_skill_lv = field[idx++].GetInt32();
-        base.max_skill_lv = field[idx++].GetInt32();
-        base.lv = field[idx++].GetInt32();
-        base.job_lv = field[idx++].GetInt32();
-        base.jp_ratio = field[idx++].GetFloat();
+    static RowBinding<SkillTreeBase> const binding = [] {
+        RowBinding<SkillTreeBase> skillTree;
+        skillTree.Column(&SkillTreeBase::job_id)
+            .Column(&SkillTreeBase::skill_id)
+            .Column(&SkillTreeBase::min_skill_lv)
+            .Column(&SkillTreeBase::max_skill_lv)
+            .Column(&SkillTreeBase::lv)
+            .Column(&SkillTreeBase::job_lv)
+            .Column(&SkillTreeBase::jp_ratio);
         for (int32_t i = 0; i < 3; i++) {
-            base.need_skill_id[i] = field[idx++].GetInt32();
-            base.need_skill_lv[i] = field[idx++].GetInt32();
+            skillTree.Element([i](SkillTreeBase &row) -> auto & { return row.need_skill_id[i]; }).Element([i](SkillTreeBase &row) -> auto & { return row.need_skill_lv[i]; });
         }
+        return skillTree;
+    }();
+
+    RowReader<SkillTreeBase> reader(GameDatabase.StreamQuery("SELECT * FROM SkillTreeResource;"), binding);
+
+    uint32_t count = 0;
+    SkillTreeBase base{};
+    while (reader.Next(base)) {
         RegisterSkillTree(base);
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Skilltrees. Table `SkillTreeResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u SkillTrees in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -544,126 +567,134 @@ void ObjectMgr::LoadSkillTreeResource()
 void ObjectMgr::LoadSkillResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM SkillResource");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Skills. Table `SkillResource` is empty!");
-        return;
-    }
+
+    static RowBinding<SkillBase> const binding = RowBinding<SkillBase>()
+                                                     .Column(&SkillBase::id)
+                                                     .Column(&SkillBase::text_id)
+                                                     .Skip(2)
+                                                     .Column(&SkillBase::is_valid)
+                                                     .Column(&SkillBase::elemental)
+                                                     .Column(&SkillBase::is_passive)
+                                                     .Column(&SkillBase::is_physical_act)
+                                                     .Column(&SkillBase::is_harmful)
+                                                     .Column(&SkillBase::is_need_target)
+                                                     .Column(&SkillBase::is_corpse)
+                                                     .Column(&SkillBase::is_toggle)
+                                                     .Column(&SkillBase::toggle_group)
+                                                     .Column(&SkillBase::casting_type)
+                                                     .Column(&SkillBase::casting_level)
+                                                     .Column(&SkillBase::cast_range)
+                                                     .Column(&SkillBase::valid_range)
+                                                     .Column(&SkillBase::cost_hp)
+                                                     .Column(&SkillBase::cost_hp_per_skl)
+                                                     .Column(&SkillBase::cost_mp)
+                                                     .Column(&SkillBase::cost_mp_per_skl)
+                                                     .Column(&SkillBase::cost_mp_per_enhance)
+                                                     .Column(&SkillBase::cost_hp_per)
+                                                     .Column(&SkillBase::cost_hp_per_skl_per)
+                                                     .Column(&SkillBase::cost_mp_per)
+                                                     .Column(&SkillBase::cost_mp_per_skl_per)
+                                                     .Column(&SkillBase::cost_havoc)
+                                                     .Column(&SkillBase::cost_havoc_per_skl)
+                                                     .Column(&SkillBase::cost_energy)
+                                                     .Column(&SkillBase::cost_energy_per_skl)
+                                                     .Column(&SkillBase::cost_exp)
+                                                     .Column(&SkillBase::cost_exp_per_enhance)
+                                                     .Column(&SkillBase::cost_jp)
+                                                     .Column(&SkillBase::cost_jp_per_enhance)
+                                                     .Column(&SkillBase::cost_item)
+                                                     .Column(&SkillBase::cost_item_count)
+                                                     .Column(&SkillBase::cost_item_count_per)
+                                                     .Column(&SkillBase::need_level)
+                                                     .Column(&SkillBase::need_hp)
+                                                     .Column(&SkillBase::need_mp)
+                                                     .Column(&SkillBase::need_havoc)
+                                                     .Column(&SkillBase::need_havoc_burst)
+                                                     .Column(&SkillBase::need_state_id)
+                                                     .Column(&SkillBase::need_state_level)
+                                                     .Column(&SkillBase::need_state_exhaust)
+                                                     .Column(&SkillBase::vf_one_hand_sword)
+                                                     .Column(&SkillBase::vf_two_hand_sword)
+                                                     .Column(&SkillBase::vf_double_sword)
+                                                     .Column(&SkillBase::vf_dagger)
+                                                     .Column(&SkillBase::vf_double_dagger)
+                                                     .Column(&SkillBase::vf_spear)
+                                                     .Column(&SkillBase::vf_axe)
+                                                     .Column(&SkillBase::vf_one_hand_axe)
+                                                     .Column(&SkillBase::vf_double_axe)
+                                                     .Column(&SkillBase::vf_one_hand_mace)
+                                                     .Column(&SkillBase::vf_two_hand_mace)
+                                                     .Column(&SkillBase::vf_lightbow)
+                                                     .Column(&SkillBase::vf_heavybow)
+                                                     .Column(&SkillBase::vf_crossbow)
+                                                     .Column(&SkillBase::vf_one_hand_staff)
+                                                     .Column(&SkillBase::vf_two_hand_staff)
+                                                     .Column(&SkillBase::vf_shield_only)
+                                                     .Column(&SkillBase::vf_is_not_need_weapon)
+                                                     .Column(&SkillBase::delay_cast)
+                                                     .Column(&SkillBase::delay_cast_per_skl)
+                                                     .Column(&SkillBase::delay_cast_mode_per)
+                                                     .Column(&SkillBase::delay_common)
+                                                     .Column(&SkillBase::delay_cooltime)
+                                                     .Column(&SkillBase::delay_cooltime_mode)
+                                                     .Column(&SkillBase::cool_time_group_id)
+                                                     .Column(&SkillBase::uf_self)
+                                                     .Column(&SkillBase::uf_party)
+                                                     .Column(&SkillBase::uf_guild)
+                                                     .Column(&SkillBase::uf_neutral)
+                                                     .Column(&SkillBase::uf_purple)
+                                                     .Column(&SkillBase::uf_enemy)
+                                                     .Column(&SkillBase::tf_avatar)
+                                                     .Column(&SkillBase::tf_summon)
+                                                     .Column(&SkillBase::tf_monster)
+                                                     .Column(&SkillBase::target)
+                                                     .Column(&SkillBase::effect_type)
+                                                     .Column(&SkillBase::state_id)
+                                                     .Column(&SkillBase::state_level_base)
+                                                     .Column(&SkillBase::state_level_per_skl)
+                                                     .Column(&SkillBase::state_level_per_enhance)
+                                                     .Column(&SkillBase::state_second)
+                                                     .Column(&SkillBase::state_second_per_level)
+                                                     .Column(&SkillBase::state_second_per_enhance)
+                                                     .Column(&SkillBase::state_type)
+                                                     .Column(&SkillBase::probability_on_hit)
+                                                     .Column(&SkillBase::probability_inc_by_slv)
+                                                     .Column(&SkillBase::hit_bonus)
+                                                     .Column(&SkillBase::hit_bonus_per_enhance)
+                                                     .Column(&SkillBase::percentage)
+                                                     .Column(&SkillBase::hate_mod)
+                                                     .Column(&SkillBase::hate_basic)
+                                                     .Column(&SkillBase::hate_per_skl)
+                                                     .Column(&SkillBase::hate_per_enhance)
+                                                     .Column(&SkillBase::critical_bonus)
+                                                     .Column(&SkillBase::critical_bonus_per_skl)
+                                                     .Column(&SkillBase::var)
+                                                     .Skip(2)
+                                                     .Column(&SkillBase::is_projectile)
+                                                     .Column(&SkillBase::projectile_speed)
+                                                     .Column(&SkillBase::projectile_acceleration);
+
+    RowReader<SkillBase> reader(GameDatabase.StreamQuery("SELECT * FROM SkillResource"), binding);
 
     uint32_t count = 0;
-    do {
-        int32_t idx = 0;
-        Field *field = result->Fetch();
-        SkillBase base{};
-        base.id = field[idx++].GetInt32();
-        base.text_id = field[idx++].GetInt32();
-        idx += 2;
-        base.is_valid = field[idx++].GetInt16();
-        base.elemental = field[idx++].GetUInt8();
-        base.is_passive = field[idx++].GetUInt8();
-        base.is_physical_act = field[idx++].GetUInt8();
-        base.is_harmful = field[idx++].GetUInt8();
-        base.is_need_target = field[idx++].GetUInt8();
-        base.is_corpse = field[idx++].GetUInt8();
-        base.is_toggle = field[idx++].GetUInt8();
-        base.toggle_group = field[idx++].GetInt32();
-        base.casting_type = field[idx++].GetUInt8();
-        base.casting_level = field[idx++].GetUInt8();
-        base.cast_range = field[idx++].GetInt32();
-        base.valid_range = field[idx++].GetInt32();
-        base.cost_hp = field[idx++].GetInt32();
-        base.cost_hp_per_skl = field[idx++].GetInt32();
-        base.cost_mp = field[idx++].GetInt32();
-        base.cost_mp_per_skl = field[idx++].GetInt32();
-        base.cost_mp_per_enhance = field[idx++].GetInt32();
-        base.cost_hp_per = field[idx++].GetFloat();
-        base.cost_hp_per_skl_per = field[idx++].GetFloat();
-        base.cost_mp_per = field[idx++].GetFloat();
-        base.cost_mp_per_skl_per = field[idx++].GetFloat();
-        base.cost_havoc = field[idx++].GetInt32();
-        base.cost_havoc_per_skl = field[idx++].GetInt32();
-        base.cost_energy = field[idx++].GetFloat();
-        base.cost_energy_per_skl = field[idx++].GetFloat();
-        base.cost_exp = field[idx++].GetInt32();
-        base.cost_exp_per_enhance = field[idx++].GetInt32();
-        base.cost_jp = field[idx++].GetInt32();
-        base.cost_jp_per_enhance = field[idx++].GetInt32();
-        base.cost_item = field[idx++].GetInt32();
-        base.cost_item_count = field[idx++].GetInt32();
-        base.cost_item_count_per = field[idx++].GetInt32();
-        base.need_level = field[idx++].GetInt32();
-        base.need_hp = field[idx++].GetInt32();
-        base.need_mp = field[idx++].GetInt32();
-        base.need_havoc = field[idx++].GetInt32();
-        base.need_havoc_burst = field[idx++].GetInt32();
-        base.need_state_id = field[idx++].GetInt16();
-        base.need_state_level = field[idx++].GetInt16();
-        base.need_state_exhaust = field[idx++].GetInt16();
-        base.vf_one_hand_sword = field[idx++].GetUInt8();
-        base.vf_two_hand_sword = field[idx++].GetUInt8();
-        base.vf_double_sword = field[idx++].GetUInt8();
-        base.vf_dagger = field[idx++].GetUInt8();
-        base.vf_double_dagger = field[idx++].GetUInt8();
-        base.vf_spear = field[idx++].GetUInt8();
-        base.vf_axe = field[idx++].GetUInt8();
-        base.vf_one_hand_axe = field[idx++].GetUInt8();
-        base.vf_double_axe = field[idx++].GetUInt8();
-        base.vf_one_hand_mace = field[idx++].GetUInt8();
-        base.vf_two_hand_mace = field[idx++].GetUInt8();
-        base.vf_lightbow = field[idx++].GetUInt8();
-        base.vf_heavybow = field[idx++].GetUInt8();
-        base.vf_crossbow = field[idx++].GetUInt8();
-        base.vf_one_hand_staff = field[idx++].GetUInt8();
-        base.vf_two_hand_staff = field[idx++].GetUInt8();
-        base.vf_shield_only = field[idx++].GetUInt8();
-        base.vf_is_not_need_weapon = field[idx++].GetUInt8();
-        base.delay_cast = field[idx++].GetFloat() * 100;
-        base.delay_cast_per_skl = field[idx++].GetFloat() * 100;
-        base.delay_cast_mode_per = field[idx++].GetFloat();
-        base.delay_common = field[idx++].GetFloat() * 100;
-        base.delay_cooltime = field[idx++].GetFloat() * 100;
-        base.delay_cooltime_mode = field[idx++].GetFloat();
-        base.cool_time_group_id = field[idx++].GetInt32();
-        base.uf_self = field[idx++].GetUInt8();
-        base.uf_party = field[idx++].GetUInt8();
-        base.uf_guild = field[idx++].GetUInt8();
-        base.uf_neutral = field[idx++].GetUInt8();
-        base.uf_purple = field[idx++].GetUInt8();
-        base.uf_enemy = field[idx++].GetUInt8();
-        base.tf_avatar = field[idx++].GetUInt8();
-        base.tf_summon = field[idx++].GetUInt8();
-        base.tf_monster = field[idx++].GetUInt8();
-        base.target = field[idx++].GetInt16();
-        base.effect_type = field[idx++].GetInt16();
-        base.state_id = field[idx++].GetInt32();
-        base.state_level_base = field[idx++].GetInt32();
-        base.state_level_per_skl = field[idx++].GetFloat();
-        base.state_level_per_enhance = field[idx++].GetFloat();
-        base.state_second = field[idx++].GetFloat() * 100;
-        base.state_second_per_level = field[idx++].GetFloat() * 100;
-        base.state_second_per_enhance = field[idx++].GetFloat() * 100;
-        base.state_type = field[idx++].GetUInt8();
-        base.probability_on_hit = field[idx++].GetInt32();
-        base.probability_inc_by_slv = field[idx++].GetInt32();
-        base.hit_bonus = field[idx++].GetInt16();
-        base.hit_bonus_per_enhance = field[idx++].GetInt16();
-        base.percentage = field[idx++].GetInt16();
-        base.hate_mod = field[idx++].GetFloat();
-        base.hate_basic = field[idx++].GetInt16();
-        base.hate_per_skl = field[idx++].GetFloat();
-        base.hate_per_enhance = field[idx++].GetFloat();
-        base.critical_bonus = field[idx++].GetInt32();
-        base.critical_bonus_per_skl = field[idx++].GetInt32();
-        for (float &i : base.var) {
-            i = field[idx++].GetFloat();
-        }
-        idx += 2;
-        base.is_projectile = field[idx++].GetInt16();
-        base.projectile_speed = field[idx++].GetFloat();
-        base.projectile_acceleration = field[idx].GetFloat();
+    SkillBase base{};
+    while (reader.Next(base)) {
+        // m_need_jp is not bound and stays zero in base
+        base.delay_cast *= 100;
+        base.delay_cast_per_skl *= 100;
+        base.delay_common *= 100;
+        base.delay_cooltime *= 100;
+        base.state_second *= 100;
+        base.state_second_per_level *= 100;
+        base.state_second_per_enhance *= 100;
         _skillBaseStore[base.id] = base;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Skills. Table `SkillResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Skills in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -733,23 +764,23 @@ void ObjectMgr::LoadDungeonResource()
 void ObjectMgr::LoadLevelResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM LevelResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Leveltemplates. DB packetHandler `LevelResource` is empty!");
-        return;
-    }
+
+    static RowBinding<LevelResourceTemplate> const binding =
+        RowBinding<LevelResourceTemplate>().Column(&LevelResourceTemplate::level).Column(&LevelResourceTemplate::normal_exp).Column(&LevelResourceTemplate::jlv);
+
+    RowReader<LevelResourceTemplate> reader(GameDatabase.StreamQuery("SELECT * FROM LevelResource;"), binding);
 
     uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        LevelResourceTemplate base{};
-        base.level = field[0].GetInt32();
-        base.normal_exp = field[1].GetInt64();
-        for (int32_t i = 0; i < 4; i++)
-            base.jlv[i] = field[2 + i].GetInt32();
+    LevelResourceTemplate base{};
+    while (reader.Next(base)) {
         _levelResourceStore[base.level] = base;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Leveltemplates. DB packetHandler `LevelResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Leveltemplates in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -757,42 +788,41 @@ void ObjectMgr::LoadLevelResource()
 void ObjectMgr::LoadStateResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT * FROM StateResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 States. Table `StateResource` is empty!");
-        return;
-    }
 
-    uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        int32_t idx = 0;
-        StateTemplate state{};
-        state.state_id = field[idx++].GetInt32();
-        state.text_id = field[idx++].GetInt32();
-        state.tooltip_id = field[idx++].GetInt32();
-        state.is_harmful = field[idx++].GetUInt8();
-        state.state_time_type = field[idx++].GetInt32();
-        state.state_group = field[idx++].GetInt32();
-        for (auto &dg : state.duplicate_group)
-            dg = field[idx++].GetInt32();
-        state.uf_avatar = field[idx++].GetUInt8();
-        state.uf_summon = field[idx++].GetUInt8();
-        state.uf_monster = field[idx++].GetUInt8();
-        state.base_effect_id = field[idx++].GetInt32();
-        state.fire_interval = field[idx++].GetInt32();
-        state.elemental_type = field[idx++].GetInt32();
-        state.amplify_base = field[idx++].GetFloat();
-        state.amplify_per_skl = field[idx++].GetFloat();
-        state.add_damage_base = field[idx++].GetInt32();
-        state.add_damage_per_skl = field[idx++].GetInt32();
-        state.effect_type = field[idx++].GetInt32();
-        for (auto &val : state.value)
-            val = field[idx++].GetFloat();
+    static RowBinding<StateTemplate> const binding = RowBinding<StateTemplate>()
+                                                         .Column(&StateTemplate::state_id)
+                                                         .Column(&StateTemplate::text_id)
+                                                         .Column(&StateTemplate::tooltip_id)
+                                                         .Column(&StateTemplate::is_harmful)
+                                                         .Column(&StateTemplate::state_time_type)
+                                                         .Column(&StateTemplate::state_group)
+                                                         .Column(&StateTemplate::duplicate_group)
+                                                         .Column(&StateTemplate::uf_avatar)
+                                                         .Column(&StateTemplate::uf_summon)
+                                                         .Column(&StateTemplate::uf_monster)
+                                                         .Column(&StateTemplate::base_effect_id)
+                                                         .Column(&StateTemplate::fire_interval)
+                                                         .Column(&StateTemplate::elemental_type)
+                                                         .Column(&StateTemplate::amplify_base)
+                                                         .Column(&StateTemplate::amplify_per_skl)
+                                                         .Column(&StateTemplate::add_damage_base)
+                                                         .Column(&StateTemplate::add_damage_per_skl)
+                                                         .Column(&StateTemplate::effect_type)
+                                                         .Column(&StateTemplate::value);
+
+    RowReader<StateTemplate> reader(GameDatabase.StreamQuery("SELECT * FROM StateResource;"), binding);
 
+    uint32_t count = 0;
+    StateTemplate state{};
+    while (reader.Next(state)) {
         _stateTemplateStore[state.state_id] = state;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 States. Table `StateResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u States in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -800,27 +830,30 @@ void ObjectMgr::LoadStateResource()
 void ObjectMgr::LoadStatResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT id, str, vit, dex, agi, `int`, men, luk FROM StatResource;");
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Stats. Table `StatResource` is empty!");
-        return;
-    }
+
+    static RowBinding<CreatureStat> const binding = RowBinding<CreatureStat>()
+                                                        .Column(&CreatureStat::stat_id)
+                                                        .Column(&CreatureStat::strength)
+                                                        .Column(&CreatureStat::vital)
+                                                        .Column(&CreatureStat::dexterity)
+                                                        .Column(&CreatureStat::agility)
+                                                        .Column(&CreatureStat::intelligence)
+                                                        .Column(&CreatureStat::mentality)
+                                                        .Column(&CreatureStat::luck);
+
+    RowReader<CreatureStat> reader(GameDatabase.StreamQuery("SELECT id, str, vit, dex, agi, `int`, men, luk FROM StatResource;"), binding);
 
     uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        CreatureStat stat{};
-        stat.stat_id = field[0].GetInt16();
-        stat.strength = field[1].GetInt32();
-        stat.vital = field[2].GetInt32();
-        stat.dexterity = field[3].GetInt32();
-        stat.agility = field[4].GetInt32();
-        stat.intelligence = field[5].GetInt32();
-        stat.mentality = field[6].GetInt32();
-        stat.luck = field[7].GetInt32();
+    CreatureStat stat{};
+    while (reader.Next(stat)) {
         _creatureBaseStore[stat.stat_id] = stat;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Stats. Table `StatResource` is empty!");
+        return;
+    }
 
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Stats in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
@@ -1147,64 +1180,70 @@ void ObjectMgr::LoadMixResource()
 void ObjectMgr::LoadSummonResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT id, type, magic_type, rate, stat_id, size, scale, standard_walk_speed, standard_run_speed,"
-                                            "walk_speed, run_speed, is_riding_only, attack_range, material, weapon_type,"
-                                            "form, evolve_target, card_id FROM SummonResource;");
 
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Summons. Table `SummonResource` is empty!");
-        return;
-    }
+    static RowBinding<SummonResourceTemplate> const binding = RowBinding<SummonResourceTemplate>()
+                                                                  .Column(&SummonResourceTemplate::id)
+                                                                  .Column(&SummonResourceTemplate::type)
+                                                                  .Column(&SummonResourceTemplate::magic_type)
+                                                                  .Column(&SummonResourceTemplate::rate)
+                                                                  .Column(&SummonResourceTemplate::stat_id)
+                                                                  .Column(&SummonResourceTemplate::size)
+                                                                  .Column(&SummonResourceTemplate::scale)
+                                                                  .Column(&SummonResourceTemplate::standard_walk_speed)
+                                                                  .Column(&SummonResourceTemplate::standard_run_speed)
+                                                                  .Column(&SummonResourceTemplate::walk_speed)
+                                                                  .Column(&SummonResourceTemplate::run_speed)
+                                                                  .Column(&SummonResourceTemplate::is_riding_only)
+                                                                  .Column(&SummonResourceTemplate::attack_range)
+                                                                  .Column(&SummonResourceTemplate::material)
+                                                                  .Column(&SummonResourceTemplate::weapon_type)
+                                                                  .Column(&SummonResourceTemplate::form)
+                                                                  .Column(&SummonResourceTemplate::evolve_target)
+                                                                  .Column(&SummonResourceTemplate::card_id);
+
+    RowReader<SummonResourceTemplate> reader(GameDatabase.StreamQuery("SELECT id, type, magic_type, rate, stat_id, size, scale, standard_walk_speed, standard_run_speed,"
+                                                                      "walk_speed, run_speed, is_riding_only, attack_range, material, weapon_type,"
+                                                                      "form, evolve_target, card_id FROM SummonResource;"),
+        binding);
 
     uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
-        SummonResourceTemplate summon{};
-        int32_t i = 0;
-        summon.id = field[i++].GetInt32();
-        summon.type = field[i++].GetInt32();
-        summon.magic_type = field[i++].GetInt32();
-        summon.rate = field[i++].GetInt32();
-        summon.stat_id = field[i++].GetInt32();
-        summon.size = field[i++].GetFloat();
-        summon.scale = field[i++].GetFloat();
-        summon.standard_walk_speed = field[i++].GetInt32();
-        summon.standard_run_speed = field[i++].GetInt32();
-        summon.walk_speed = field[i++].GetInt32();
-        summon.run_speed = field[i++].GetInt32();
-        summon.is_riding_only = field[i++].GetBool();
-        summon.attack_range = field[i++].GetFloat();
-        summon.material = field[i++].GetInt32();
-        summon.weapon_type = field[i++].GetInt32();
-        summon.form = field[i++].GetInt32();
-        summon.evolve_target = field[i++].GetInt32();
-        summon.card_id = field[i].GetInt32();
+    SummonResourceTemplate summon{};
+    while (reader.Next(summon)) {
         _summonResourceStore[summon.id] = summon;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Summons. Table `SummonResource` is empty!");
+        return;
+    }
+
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Summons in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
 void ObjectMgr::LoadStringResource()
 {
     uint32_t oldMSTime = getMSTime();
-    QueryResult result = GameDatabase.Query("SELECT code, value FROM StringResource;");
-
-    if (!result) {
-        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Strings. Table `StringResource` is empty!");
-        return;
-    }
 
-    uint32_t count = 0;
-    do {
-        Field *field = result->Fetch();
+    struct StringRow {
+        int32_t code;
+        std::string value;
+    };
+    static RowBinding<StringRow> const binding = RowBinding<StringRow>().Column(&StringRow::code).Column(&StringRow::value);
 
-        int32_t code = field[0].GetInt32();
-        const std::string value = field[1].GetString();
-        _stringResourceStore[code] = value;
+    RowReader<StringRow> reader(GameDatabase.StreamQuery("SELECT code, value FROM StringResource;"), binding);
 
+    uint32_t count = 0;
+    StringRow row{};
+    while (reader.Next(row)) {
+        _stringResourceStore[row.code] = row.value;
         ++count;
-    } while (result->NextRow());
+    }
+
+    if (count == 0) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded 0 Strings. Table `StringResource` is empty!");
+        return;
+    }
     NG_LOG_INFO("server.worldserver", ">> Loaded %u Strings in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -1303,6 +1342,23 @@ DropGroup *ObjectMgr::GetDropGroupInfo(int32_t drop_group_id)
     return nullptr;
 }
 
+void ObjectMgr::EnumContentScripts(const std::function<void(const std::string &)> &fn) const
+{
+    for (const auto &npc : _npcTemplateStore)
+        fn(npc.second.contact_script);
+    for (const auto &prop : _fieldPropTemplateStore)
+        fn(prop.second.strScript);
+    for (const auto &quest : _questTemplateStore) {
+        fn(quest.second.strAcceptScript);
+        fn(quest.second.strClearScript);
+    }
+    for (const auto &item : _itemTemplateStore) {
+        // on_use_item gets its arguments formatted in at use time, see Player::UseItem
+        if (item.second->script_text.find("on_use_item") == std::string::npos)
+            fn(item.second->script_text);
+    }
+}
+
 void ObjectMgr::RegisterMonsterRespawnInfo(MonsterRespawnInfo info)
 {
     if (_monsterBaseStore.count(info.monster_id))
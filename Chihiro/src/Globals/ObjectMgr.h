@@ -15,6 +15,7 @@
  *  You should have received a copy of the GNU General Public License along
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <functional>
 #include <unordered_map>
 
 #include "Common.h"
@@ -131,6 +132,8 @@ public:
     int64_t GetNeedSummonExp(int32_t level);
     WayPointInfo *GetWayPoint(int32_t waypoint_id);
     DropGroup *GetDropGroupInfo(int32_t drop_group_id);
+    /// \brief Calls fn for every static lua snippet referenced by the loaded content (NPC contact, field prop, quest and item scripts)
+    void EnumContentScripts(const std::function<void(const std::string &)> &fn) const;
 
     void RegisterMonsterRespawnInfo(MonsterRespawnInfo info);
     void AddWayPoint(int32_t waypoint_id, float x, float y);
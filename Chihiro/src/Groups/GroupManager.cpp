@@ -181,7 +181,7 @@ void GroupManager::GetNearMember(Player *pPlayer, float distance, std::vector<Pl
 
     for (auto &p : info->vMemberNameList) {
         auto player = Player::FindPlayer(p.strName);
-        if (player != nullptr && player->GetExactDist2d(pPlayer) <= distance) {
+        if (player != nullptr && player->GetExactDist2dSq(pPlayer) <= distance * distance) {
             vList.emplace_back(player);
         }
     }
@@ -22,13 +22,20 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
+#include "InterestManager.h"
+#include "LineOfSight.h"
 #include "Maploader.h"
 #include "MemPool.h"
+#include "Metrics.h"
 #include "MySQLThreading.h"
 #include "NGInit.h"
 #include "ObjectMgr.h"
+#include "RegionSleep.h"
 #include "Stacktrace.h"
 #include "SystemConfigs.h"
+#include "TickProfiler.h"
+#include "TickScheduler.h"
+#include "UnitUpdateAggregator.h"
 #include "WorldSession.h"
 #include "XSocketMgr.h"
 
@@ -41,9 +48,7 @@ void StopDB();
 void WorldUpdateLoop();
 void ShutdownCLIThread(std::thread *cliThread);
 void SignalHandler(boost::system::error_code const &error, int32_t signalNumber);
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error);
-
-constexpr int32_t WORLD_SLEEP_CONST = 50;
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error);
 
 int32_t main(int32_t argc, char **argv)
 {
@@ -64,12 +69,18 @@ int32_t main(int32_t argc, char **argv)
 #endif
     signals.async_wait(SignalHandler);
 
-    // Enabled a timed callback for handling the database keep alive ping
-    int32_t dbPingInterval = sConfigMgr->GetIntDefault("MaxPingTime", 30);
-    std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
-    dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-    dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, std::weak_ptr<boost::asio::deadline_timer>(dbPingTimer), dbPingInterval, std::placeholders::_1));
-
+    // Enabled a timed callback for the database pools, they ping idle connections and adjust their size to the load
+    std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
+    dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+    dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, std::weak_ptr<boost::asio::deadline_timer>(dbMaintenanceTimer), std::placeholders::_1));
+
+    sMetrics.InitializeMetrics();
+    sTickProfiler.InitializeTickProfiler();
+    sTickScheduler.InitializeTickScheduler();
+    sUnitUpdateAggregator.InitializeUnitUpdateAggregator();
+    sInterestManager.InitializeInterestManager();
+    sLineOfSight.InitializeLineOfSight();
+    sRegionSleep.InitializeRegionSleep();
     sWorld.InitWorld();
     if (!sAuthNetwork.InitializeNetwork(*ioContext, sConfigMgr->GetStringDefault("AuthServer.IP", "127.0.0.1"), sConfigMgr->GetIntDefault("AuthServer.Port", 4502))) {
         NG_LOG_ERROR("server.worldserver", "Cannot connect to the auth server!");
@@ -125,7 +136,7 @@ int32_t main(int32_t argc, char **argv)
     sLog->SetSynchronous();
 
     pWorldNetwork->StopNetwork();
-    dbPingTimer->cancel();
+    dbMaintenanceTimer->cancel();
     signals.cancel();
 
     int32_t exitCode = World::GetExitCode();
@@ -140,16 +151,15 @@ void SignalHandler(boost::system::error_code const &error, int32_t /*signalNumbe
         World::StopNow(SHUTDOWN_EXIT_CODE);
 }
 
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error)
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error)
 {
     if (!error) {
-        if (std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = dbPingTimerRef.lock()) {
-            NG_LOG_INFO("server.worldserver", "Ping MySQL to keep connection alive");
-            GameDatabase.KeepAlive();
-            CharacterDatabase.KeepAlive();
+        if (std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = dbMaintenanceTimerRef.lock()) {
+            GameDatabase.Maintain();
+            CharacterDatabase.Maintain();
 
-            dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-            dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, dbPingTimerRef, dbPingInterval, std::placeholders::_1));
+            dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+            dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, dbMaintenanceTimerRef, std::placeholders::_1));
         }
     }
 }
@@ -180,24 +190,24 @@ void StopDB()
 
 void WorldUpdateLoop()
 {
-    uint32_t realCurrTime = 0;
-    uint32_t realPrevTime = getMSTime();
+    auto &tickTime = sMetrics.GetHistogram("world.tick_us");
 
     ///- While we have not World::m_stopEvent, update the world
     while (!World::IsStopped()) {
         ++World::m_worldLoopCounter;
-        realCurrTime = getMSTime();
 
-        uint32_t diff = getMSTimeDiff(realPrevTime, realCurrTime);
-        auto t = 12;
-        sWorld.Update(diff);
-        realPrevTime = realCurrTime;
-
-        uint32_t executionTimeDiff = getMSTimeDiff(realCurrTime, getMSTime());
+        uint32_t diff = sTickScheduler.BeginTick();
+        sTickProfiler.BeginTick();
+        {
+            NGemity::Metrics::ScopedTimer tickTimer(tickTime);
+            sWorld.Update(diff);
+        }
+        XSocket::FlushSendBatches();
+        sTickProfiler.EndTick();
+        sMetrics.Update(diff);
 
-        // we know exactly how long it took to update the world, if the update took less than WORLD_SLEEP_CONST, sleep for WORLD_SLEEP_CONST - world update time
-        if (executionTimeDiff < WORLD_SLEEP_CONST)
-            std::this_thread::sleep_for(std::chrono::milliseconds(WORLD_SLEEP_CONST - executionTimeDiff));
+        // Sleeps until the next tick is due, or returns right away to catch up after a slow one
+        sTickScheduler.EndTick();
     }
 }
 
@@ -0,0 +1,233 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InterestManager.h"
+
+#include <algorithm>
+
+#include "ClientPackets.h"
+#include "Config.h"
+#include "EnterPacketEncoder.h"
+#include "MemPool.h"
+#include "Messages.h"
+#include "Player.h"
+#include "RegionContainer.h"
+
+void InterestManager::InitializeInterestManager()
+{
+    m_bEnabled = sConfigMgr->GetBoolDefault("World.InterestManagement", true);
+    m_nHysteresis = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.InterestHysteresis", 1), 0));
+    m_nMaxEnters = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.MaxEntersPerTick", 48), 1));
+}
+
+void InterestManager::Show(Player *pClient, WorldObject *pObject)
+{
+    if (pClient == nullptr || pObject == nullptr || pClient == pObject)
+        return;
+
+    if (!m_bEnabled) {
+        Messages::sendEnterMessage(pClient, pObject, false);
+        return;
+    }
+
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        auto &interest = m_mClients[pClient->GetHandle()];
+        if (!interest.sKnown.emplace(pObject->GetHandle()).second)
+            return;
+        addObserver(pObject->GetHandle(), pClient->GetHandle());
+
+        if (interest.nSent >= m_nMaxEnters || !interest.vPending.empty()) {
+            interest.vPending.emplace_back(pObject->GetHandle());
+            return;
+        }
+        ++interest.nSent;
+    }
+    Messages::sendEnterMessage(pClient, pObject, false);
+}
+
+void InterestManager::ShowNow(Player *pClient, WorldObject *pObject)
+{
+    if (pClient == nullptr || pObject == nullptr)
+        return;
+
+    if (m_bEnabled) {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        auto &interest = m_mClients[pClient->GetHandle()];
+        if (interest.sKnown.emplace(pObject->GetHandle()).second)
+            addObserver(pObject->GetHandle(), pClient->GetHandle());
+        else
+            interest.vPending.erase(std::remove(interest.vPending.begin(), interest.vPending.end(), pObject->GetHandle()), interest.vPending.end());
+    }
+    Messages::sendEnterMessage(pClient, pObject, false);
+}
+
+void InterestManager::Forget(WorldObject *pObject)
+{
+    if (!m_bEnabled || pObject == nullptr)
+        return;
+
+    std::vector<Player *> vLeave{};
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        auto nHandle = pObject->GetHandle();
+
+        // A player leaving the world starts over with an empty view
+        auto client = m_mClients.find(nHandle);
+        if (client != m_mClients.end()) {
+            for (auto nKnown : client->second.sKnown)
+                removeObserver(nKnown, nHandle);
+            m_mClients.erase(client);
+        }
+
+        auto observers = m_mObservers.find(nHandle);
+        if (observers == m_mObservers.end())
+            return;
+
+        for (auto nClient : observers->second) {
+            auto interest = m_mClients.find(nClient);
+            if (interest == m_mClients.end())
+                continue;
+            interest->second.sKnown.erase(nHandle);
+            auto &vPending = interest->second.vPending;
+            vPending.erase(std::remove(vPending.begin(), vPending.end(), nHandle), vPending.end());
+
+            auto pClient = sMemoryPool.GetObjectInWorld<Player>(nClient);
+            if (pClient != nullptr && (pClient->GetLayer() != pObject->GetLayer() || sRegion.IsVisibleRegion(pClient, pObject) == 0))
+                vLeave.emplace_back(pClient);
+        }
+        m_mObservers.erase(observers);
+    }
+
+    TS_SC_LEAVE leavePct{};
+    leavePct.handle = pObject->GetHandle();
+    for (auto pClient : vLeave)
+        pClient->SendPacket(leavePct);
+}
+
+void InterestManager::Update()
+{
+    if (!m_bEnabled)
+        return;
+
+    std::vector<std::pair<Player *, WorldObject *>> vEnter{};
+    std::vector<std::pair<Player *, uint32_t>> vLeave{};
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        ++m_nTick;
+        for (auto &[nClient, interest] : m_mClients) {
+            interest.nSent = 0;
+            if (!interest.vPending.empty())
+                flushPending(nClient, interest, vEnter);
+            if ((nClient + m_nTick) % m_nSweepTicks == 0)
+                sweep(nClient, interest, vLeave);
+        }
+    }
+
+    // flushPending keeps the enters of one client together
+    for (std::size_t i = 0; i < vEnter.size();) {
+        EnterPacketEncoder::Burst burst(vEnter[i].first);
+        for (auto pClient = vEnter[i].first; i < vEnter.size() && vEnter[i].first == pClient; ++i)
+            Messages::sendEnterMessage(pClient, vEnter[i].second, false);
+    }
+
+    TS_SC_LEAVE leavePct{};
+    for (auto &[pClient, nHandle] : vLeave) {
+        leavePct.handle = nHandle;
+        pClient->SendPacket(leavePct);
+    }
+}
+
+void InterestManager::addObserver(uint32_t nObject, uint32_t nClient)
+{
+    m_mObservers[nObject].emplace_back(nClient);
+}
+
+void InterestManager::removeObserver(uint32_t nObject, uint32_t nClient)
+{
+    auto observers = m_mObservers.find(nObject);
+    if (observers == m_mObservers.end())
+        return;
+
+    auto &vClients = observers->second;
+    auto it = std::find(vClients.begin(), vClients.end(), nClient);
+    if (it != vClients.end()) {
+        *it = vClients.back();
+        vClients.pop_back();
+    }
+    if (vClients.empty())
+        m_mObservers.erase(observers);
+}
+
+void InterestManager::flushPending(uint32_t nClient, ClientInterest &interest, std::vector<std::pair<Player *, WorldObject *>> &vEnter)
+{
+    auto pClient = sMemoryPool.GetObjectInWorld<Player>(nClient);
+    if (pClient == nullptr)
+        return;
+
+    // Nearest first, what is left over goes out with the next ticks
+    std::vector<std::pair<float, WorldObject *>> vObjects{};
+    vObjects.reserve(interest.vPending.size());
+    for (auto nHandle : interest.vPending) {
+        auto pObject = sMemoryPool.GetObjectInWorld<WorldObject>(nHandle);
+        if (pObject == nullptr || !pObject->IsInWorld()) {
+            interest.sKnown.erase(nHandle);
+            removeObserver(nHandle, nClient);
+            continue;
+        }
+        vObjects.emplace_back(pClient->GetExactDist2dSq(pObject), pObject);
+    }
+
+    auto nCount = std::min<std::size_t>(vObjects.size(), m_nMaxEnters);
+    std::partial_sort(vObjects.begin(), vObjects.begin() + nCount, vObjects.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    interest.vPending.clear();
+    for (std::size_t i = 0; i < vObjects.size(); ++i) {
+        if (i < nCount)
+            vEnter.emplace_back(pClient, vObjects[i].second);
+        else
+            interest.vPending.emplace_back(vObjects[i].second->GetHandle());
+    }
+    interest.nSent = static_cast<uint32_t>(nCount);
+}
+
+void InterestManager::sweep(uint32_t nClient, ClientInterest &interest, std::vector<std::pair<Player *, uint32_t>> &vLeave)
+{
+    auto pClient = sMemoryPool.GetObjectInWorld<Player>(nClient);
+    if (pClient == nullptr)
+        return;
+
+    auto rx = static_cast<int32_t>(pClient->GetRX());
+    auto ry = static_cast<int32_t>(pClient->GetRY());
+    auto nRange = static_cast<int32_t>(VISIBLE_REGION_RANGE + m_nHysteresis);
+
+    for (auto it = interest.sKnown.begin(); it != interest.sKnown.end();) {
+        auto nHandle = *it;
+        auto pObject = sMemoryPool.GetObjectInWorld<WorldObject>(nHandle);
+        if (pObject != nullptr && pObject->IsInWorld() && pObject->GetLayer() == pClient->GetLayer() && std::abs(static_cast<int32_t>(pObject->GetRX()) - rx) <= nRange &&
+            std::abs(static_cast<int32_t>(pObject->GetRY()) - ry) <= nRange) {
+            ++it;
+            continue;
+        }
+
+        if (pObject != nullptr)
+            vLeave.emplace_back(pClient, nHandle);
+        interest.vPending.erase(std::remove(interest.vPending.begin(), interest.vPending.end(), nHandle), interest.vPending.end());
+        removeObserver(nHandle, nClient);
+        it = interest.sKnown.erase(it);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Define.h"
+#include "SharedMutex.h"
+
+class Player;
+class WorldObject;
+
+/// \brief Keeps track of the objects each client has been sent a TS_SC_ENTER for
+/// An object only gets an enter when it is not known to the client yet, so walking back and
+/// forth over a region border sends nothing. Known objects are dropped with a TS_SC_LEAVE once
+/// they are more than World.InterestHysteresis regions outside of the visible range; the sweep
+/// doing so runs over a slice of the clients every tick.
+///
+/// At most World.MaxEntersPerTick enters go to a client per tick, the rest is queued and sent
+/// nearest first on the following ticks (logging in to a crowded town, warping).
+/// Enters are requested from the network threads as well, everything is locked.
+class InterestManager {
+public:
+    static InterestManager &Instance()
+    {
+        static InterestManager instance;
+        return instance;
+    }
+
+    ~InterestManager() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    InterestManager(const InterestManager &) = delete;
+    InterestManager &operator=(const InterestManager &) = delete;
+
+    void InitializeInterestManager();
+
+    /// \brief Sends pObject to pClient unless the client knows it already
+    void Show(Player *pClient, WorldObject *pObject);
+    /// \brief Sends pObject right away and marks it known, for objects the client asked for
+    void ShowNow(Player *pClient, WorldObject *pObject);
+    /// \brief Forgets pObject after it left the world
+    /// Clients that know it but did not get the leave broadcast, being too far away, get one here.
+    void Forget(WorldObject *pObject);
+
+    /// \brief Sends queued enters and drops objects out of range, called once per world tick
+    void Update();
+
+private:
+    InterestManager() = default;
+
+    struct ClientInterest {
+        std::unordered_set<uint32_t> sKnown{};
+        std::vector<uint32_t> vPending{}; // known, but the enter is not sent yet
+        uint32_t nSent{0};                // enters sent this tick
+    };
+
+    void addObserver(uint32_t nObject, uint32_t nClient);
+    void removeObserver(uint32_t nObject, uint32_t nClient);
+    void flushPending(uint32_t nClient, ClientInterest &interest, std::vector<std::pair<Player *, WorldObject *>> &vEnter);
+    void sweep(uint32_t nClient, ClientInterest &interest, std::vector<std::pair<Player *, uint32_t>> &vLeave);
+
+    bool m_bEnabled{true};
+    uint32_t m_nHysteresis{1};
+    uint32_t m_nMaxEnters{48};
+    uint32_t m_nSweepTicks{20}; // every client is swept once per this many ticks
+    uint32_t m_nTick{0};
+
+    NG_SHARED_MUTEX i_lock;
+    std::unordered_map<uint32_t, ClientInterest> m_mClients{};              // player handle -> known objects
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_mObservers{};     // object handle -> players knowing it
+};
+
+#define sInterestManager InterestManager::Instance()
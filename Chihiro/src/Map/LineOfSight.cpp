@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSight.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Config.h"
+#include "ObjectMgr.h"
+
+void LineOfSight::InitializeLineOfSight()
+{
+    m_bEnabled = sConfigMgr->GetBoolDefault("World.LineOfSightCache", true);
+    m_fPrecision = std::max(sConfigMgr->GetFloatDefault("World.LineOfSightPrecision", 4.0f), 0.5f);
+    m_nCacheTicks = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.LineOfSightCacheTicks", 20), 1));
+}
+
+bool LineOfSight::CollisionToLine(float x1, float y1, float x2, float y2)
+{
+    if (!m_bEnabled)
+        return sObjectMgr.g_qtBlockInfo.LooseCollision({{x1, y1}, {x2, y2}});
+
+    auto key = makeKey(x1, y1, x2, y2);
+    bool bBlocked{false};
+    if (find(key, bBlocked))
+        return bBlocked;
+
+    bBlocked = sObjectMgr.g_qtBlockInfo.LooseCollision({{x1, y1}, {x2, y2}});
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        m_mCurrent[key] = bBlocked;
+    }
+    return bBlocked;
+}
+
+void LineOfSight::CollisionToLines(float x, float y, const float *pX, const float *pY, uint8_t *pBlocked, std::size_t nCount)
+{
+    if (!m_bEnabled) {
+        for (std::size_t i = 0; i < nCount; ++i)
+            pBlocked[i] = static_cast<uint8_t>(sObjectMgr.g_qtBlockInfo.LooseCollision({{x, y}, {pX[i], pY[i]}}));
+        return;
+    }
+
+    // One pass under the lock for the hits, the misses are traced without it and stored together
+    std::vector<std::pair<LineKey, std::size_t>> vMissing{};
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        for (std::size_t i = 0; i < nCount; ++i) {
+            auto key = makeKey(x, y, pX[i], pY[i]);
+            auto it = m_mCurrent.find(key);
+            if (it != m_mCurrent.end()) {
+                pBlocked[i] = static_cast<uint8_t>(it->second);
+                continue;
+            }
+            it = m_mPrevious.find(key);
+            if (it != m_mPrevious.end()) {
+                pBlocked[i] = static_cast<uint8_t>(it->second);
+                m_mCurrent.emplace(key, it->second);
+                continue;
+            }
+            vMissing.emplace_back(key, i);
+        }
+    }
+    if (vMissing.empty())
+        return;
+
+    for (auto &[key, i] : vMissing)
+        pBlocked[i] = static_cast<uint8_t>(sObjectMgr.g_qtBlockInfo.LooseCollision({{x, y}, {pX[i], pY[i]}}));
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    for (auto &[key, i] : vMissing)
+        m_mCurrent[key] = pBlocked[i] != 0;
+}
+
+void LineOfSight::Update()
+{
+    if (!m_bEnabled || ++m_nTick < m_nCacheTicks)
+        return;
+
+    m_nTick = 0;
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    m_mPrevious = std::move(m_mCurrent);
+    m_mCurrent = LineCache{};
+}
+
+LineOfSight::LineKey LineOfSight::makeKey(float x1, float y1, float x2, float y2) const
+{
+    return LineKey{static_cast<int32_t>(std::floor(x1 / m_fPrecision)), static_cast<int32_t>(std::floor(y1 / m_fPrecision)), static_cast<int32_t>(std::floor(x2 / m_fPrecision)),
+        static_cast<int32_t>(std::floor(y2 / m_fPrecision))};
+}
+
+bool LineOfSight::find(const LineKey &key, bool &bBlocked)
+{
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto it = m_mCurrent.find(key);
+    if (it != m_mCurrent.end()) {
+        bBlocked = it->second;
+        return true;
+    }
+
+    // Still in use, carry it over into the current generation
+    it = m_mPrevious.find(key);
+    if (it == m_mPrevious.end())
+        return false;
+    bBlocked = it->second;
+    m_mCurrent.emplace(key, bBlocked);
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <unordered_map>
+
+#include "Define.h"
+#include "SharedMutex.h"
+
+/// \brief Cached line collision tests against the blocking polygons of the map
+/// Both ends of a line are snapped to a grid of World.LineOfSightPrecision units. A line whose
+/// ends stay within the same cells reuses the earlier result, so an attacker and a target that
+/// moved less than that are not traced through the quad tree again.
+///
+/// Results live for World.LineOfSightCacheTicks world ticks. The cache keeps two generations and
+/// drops the older one at each rotation, so a line tested every tick never expires.
+class LineOfSight {
+public:
+    static LineOfSight &Instance()
+    {
+        static LineOfSight instance;
+        return instance;
+    }
+
+    ~LineOfSight() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    LineOfSight(const LineOfSight &) = delete;
+    LineOfSight &operator=(const LineOfSight &) = delete;
+
+    void InitializeLineOfSight();
+
+    /// \brief true if the line from (x1, y1) to (x2, y2) crosses a blocked area
+    bool CollisionToLine(float x1, float y1, float x2, float y2);
+    /// \brief CollisionToLine from one origin to nCount targets, pBlocked gets 1 for every blocked line
+    void CollisionToLines(float x, float y, const float *pX, const float *pY, uint8_t *pBlocked, std::size_t nCount);
+
+    /// \brief Ages the cached results, called once per world tick
+    void Update();
+
+private:
+    LineOfSight() = default;
+
+    struct LineKey {
+        int32_t x1, y1, x2, y2;
+        bool operator==(const LineKey &rhs) const { return x1 == rhs.x1 && y1 == rhs.y1 && x2 == rhs.x2 && y2 == rhs.y2; }
+    };
+
+    struct LineKeyHash {
+        std::size_t operator()(const LineKey &key) const
+        {
+            uint64_t nHash = (static_cast<uint64_t>(static_cast<uint32_t>(key.x1)) << 32) ^ static_cast<uint32_t>(key.y1);
+            nHash = nHash * 0x9E3779B97F4A7C15ULL ^ ((static_cast<uint64_t>(static_cast<uint32_t>(key.x2)) << 32) ^ static_cast<uint32_t>(key.y2));
+            return static_cast<std::size_t>(nHash * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    using LineCache = std::unordered_map<LineKey, bool, LineKeyHash>;
+
+    LineKey makeKey(float x1, float y1, float x2, float y2) const;
+    bool find(const LineKey &key, bool &bBlocked);
+
+    bool m_bEnabled{true};
+    float m_fPrecision{4.0f};
+    uint32_t m_nCacheTicks{20};
+    uint32_t m_nTick{0};
+
+    NG_SHARED_MUTEX i_lock;
+    LineCache m_mCurrent{};
+    LineCache m_mPrevious{};
+};
+
+#define sLineOfSight LineOfSight::Instance()
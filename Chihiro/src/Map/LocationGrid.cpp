@@ -0,0 +1,235 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LocationGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+
+#include "Log.h"
+#include "Timer.h"
+
+constexpr uint32_t LOCATION_GRID_MAGIC = 0x474C474E; // NGLG
+constexpr uint32_t LOCATION_GRID_VERSION = 1;
+
+void LocationGrid::Initialize(const std::string &szCacheFile, float fCellSize)
+{
+    m_fCellSize = fCellSize;
+    if (m_vLocations.empty())
+        return;
+
+    if (load(szCacheFile)) {
+        NG_LOG_INFO("server.worldserver", ">> Loaded location grid %ux%u from %s", m_nWidth, m_nHeight, szCacheFile.c_str());
+        return;
+    }
+
+    uint32_t oldMSTime = getMSTime();
+    build();
+    NG_LOG_INFO("server.worldserver", ">> Built location grid %ux%u with %u border entries in %u ms", m_nWidth, m_nHeight, static_cast<uint32_t>(m_vCandidates.size()),
+        GetMSTimeDiffToNow(oldMSTime));
+    save(szCacheFile);
+}
+
+int32_t LocationGrid::GetLocationID(float x, float y)
+{
+    if (x < 0 || y < 0)
+        return 0;
+
+    auto cx = static_cast<uint32_t>(x / m_fCellSize);
+    auto cy = static_cast<uint32_t>(y / m_fCellSize);
+    if (cx >= m_nWidth || cy >= m_nHeight)
+        return 0;
+
+    int32_t nCell = m_vCells[cy * m_nWidth + cx];
+    if (nCell >= 0)
+        return nCell;
+
+    X2D::Pointf pt{x, y};
+    auto nOffset = static_cast<uint32_t>(-nCell - 1);
+    for (uint32_t i = 1; i <= m_vCandidates[nOffset]; ++i) {
+        auto &info = m_vLocations[m_vCandidates[nOffset + i]];
+        if (info.IsInclude(pt))
+            return info.location_id;
+    }
+    return 0;
+}
+
+void LocationGrid::build()
+{
+    float fRight = 0;
+    float fBottom = 0;
+    for (auto &info : m_vLocations) {
+        fRight = std::max(fRight, info.m_Area.m_BottomRight.x);
+        fBottom = std::max(fBottom, info.m_Area.m_BottomRight.y);
+    }
+    m_nWidth = static_cast<uint32_t>(fRight / m_fCellSize) + 1;
+    m_nHeight = static_cast<uint32_t>(fBottom / m_fCellSize) + 1;
+
+    // Best priority first, a stable sort keeps the registration order for equal ones
+    std::vector<uint32_t> vOrder(m_vLocations.size());
+    std::iota(vOrder.begin(), vOrder.end(), 0);
+    std::stable_sort(vOrder.begin(), vOrder.end(), [this](uint32_t lhs, uint32_t rhs) { return m_vLocations[lhs].priority < m_vLocations[rhs].priority; });
+
+    std::vector<int32_t> vCells(static_cast<std::size_t>(m_nWidth) * m_nHeight, 0);
+    std::vector<bool> vResolved(vCells.size(), false);
+    std::unordered_map<uint32_t, std::vector<uint32_t>> mBorder{};
+
+    for (auto nIndex : vOrder) {
+        auto &info = m_vLocations[nIndex];
+        auto cx0 = static_cast<uint32_t>(std::max(info.m_Area.m_TopLeft.x, 0.0f) / m_fCellSize);
+        auto cy0 = static_cast<uint32_t>(std::max(info.m_Area.m_TopLeft.y, 0.0f) / m_fCellSize);
+        auto cx1 = std::min(static_cast<uint32_t>(std::max(info.m_Area.m_BottomRight.x, 0.0f) / m_fCellSize), m_nWidth - 1);
+        auto cy1 = std::min(static_cast<uint32_t>(std::max(info.m_Area.m_BottomRight.y, 0.0f) / m_fCellSize), m_nHeight - 1);
+
+        for (uint32_t cy = cy0; cy <= cy1; ++cy) {
+            for (uint32_t cx = cx0; cx <= cx1; ++cx) {
+                uint32_t nCell = cy * m_nWidth + cx;
+                if (vResolved[nCell])
+                    continue;
+
+                X2D::RectangleF rc{X2D::Pointf{cx * m_fCellSize, cy * m_fCellSize}, X2D::Pointf{(cx + 1) * m_fCellSize, (cy + 1) * m_fCellSize}};
+                if (covers(info, rc)) {
+                    // Nothing after this one can win inside the cell
+                    vResolved[nCell] = true;
+                    auto border = mBorder.find(nCell);
+                    if (border == mBorder.end())
+                        vCells[nCell] = info.location_id;
+                    else
+                        border->second.emplace_back(nIndex);
+                }
+                else if (info.IsCollision(rc)) {
+                    mBorder[nCell].emplace_back(nIndex);
+                }
+            }
+        }
+    }
+
+    m_vCandidates.clear();
+    for (auto &[nCell, vList] : mBorder) {
+        vCells[nCell] = -static_cast<int32_t>(m_vCandidates.size()) - 1;
+        m_vCandidates.emplace_back(static_cast<uint32_t>(vList.size()));
+        m_vCandidates.insert(m_vCandidates.end(), vList.begin(), vList.end());
+    }
+    m_vCells = std::move(vCells);
+}
+
+bool LocationGrid::covers(MapLocationInfo &info, const X2D::RectangleF &rc)
+{
+    // The cell is half open, its far corners are the last points still inside
+    float fRight = std::nextafter(rc.m_BottomRight.x, rc.m_TopLeft.x);
+    float fBottom = std::nextafter(rc.m_BottomRight.y, rc.m_TopLeft.y);
+    if (!info.IsInclude(X2D::Pointf{rc.m_TopLeft.x, rc.m_TopLeft.y}) || !info.IsInclude(X2D::Pointf{fRight, rc.m_TopLeft.y}) ||
+        !info.IsInclude(X2D::Pointf{fRight, fBottom}) || !info.IsInclude(X2D::Pointf{rc.m_TopLeft.x, fBottom}))
+        return false;
+
+    // A concave polygon may still cut into the cell between the corners
+    for (auto &p : info.m_Points) {
+        if (p.x > rc.m_TopLeft.x && p.x < rc.m_BottomRight.x && p.y > rc.m_TopLeft.y && p.y < rc.m_BottomRight.y)
+            return false;
+    }
+
+    X2D::Pointf vCorner[4] = {rc.m_TopLeft, X2D::Pointf{rc.m_BottomRight.x, rc.m_TopLeft.y}, rc.m_BottomRight, X2D::Pointf{rc.m_TopLeft.x, rc.m_BottomRight.y}};
+    for (uint32_t i = 0; i < static_cast<uint32_t>(info.m_Points.size()); ++i) {
+        auto segment = info.GetSegment(i);
+        for (int32_t c = 0; c < 4; ++c) {
+            if (X2D::Linef::IntersectCCW(segment.begin, segment.end, vCorner[c], vCorner[(c + 1) % 4]) == X2D::Linef::IntersectResult::Intersect)
+                return false;
+        }
+    }
+    return true;
+}
+
+uint64_t LocationGrid::signature() const
+{
+    // FNV-1a over everything the grid is built from
+    uint64_t nHash = 0xcbf29ce484222325ULL;
+    auto mix = [&nHash](const void *pData, std::size_t nSize) {
+        auto pBytes = static_cast<const uint8_t *>(pData);
+        for (std::size_t i = 0; i < nSize; ++i) {
+            nHash ^= pBytes[i];
+            nHash *= 0x100000001b3ULL;
+        }
+    };
+
+    mix(&m_fCellSize, sizeof(m_fCellSize));
+    for (auto &info : m_vLocations) {
+        mix(&info.location_id, sizeof(info.location_id));
+        mix(&info.priority, sizeof(info.priority));
+        for (auto &p : info.m_Points) {
+            mix(&p.x, sizeof(p.x));
+            mix(&p.y, sizeof(p.y));
+        }
+    }
+    return nHash;
+}
+
+bool LocationGrid::load(const std::string &szCacheFile)
+{
+    std::ifstream infile(szCacheFile.c_str(), std::ios::in | std::ios::binary);
+    if (!infile)
+        return false;
+
+    uint32_t nMagic{0}, nVersion{0}, nCells{0}, nCandidates{0};
+    uint64_t nSignature{0};
+    infile.read(reinterpret_cast<char *>(&nMagic), sizeof(nMagic));
+    infile.read(reinterpret_cast<char *>(&nVersion), sizeof(nVersion));
+    infile.read(reinterpret_cast<char *>(&nSignature), sizeof(nSignature));
+    if (!infile || nMagic != LOCATION_GRID_MAGIC || nVersion != LOCATION_GRID_VERSION || nSignature != signature())
+        return false;
+
+    infile.read(reinterpret_cast<char *>(&m_nWidth), sizeof(m_nWidth));
+    infile.read(reinterpret_cast<char *>(&m_nHeight), sizeof(m_nHeight));
+    infile.read(reinterpret_cast<char *>(&nCells), sizeof(nCells));
+    if (!infile || nCells != m_nWidth * m_nHeight)
+        return false;
+    m_vCells.resize(nCells);
+    infile.read(reinterpret_cast<char *>(m_vCells.data()), nCells * sizeof(int32_t));
+
+    infile.read(reinterpret_cast<char *>(&nCandidates), sizeof(nCandidates));
+    m_vCandidates.resize(nCandidates);
+    infile.read(reinterpret_cast<char *>(m_vCandidates.data()), nCandidates * sizeof(uint32_t));
+    if (!infile) {
+        m_vCells.clear();
+        m_vCandidates.clear();
+        return false;
+    }
+    return true;
+}
+
+void LocationGrid::save(const std::string &szCacheFile) const
+{
+    std::ofstream outfile(szCacheFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outfile) {
+        NG_LOG_WARN("server.worldserver", "Cannot write the location grid cache %s, it is built again on the next start.", szCacheFile.c_str());
+        return;
+    }
+
+    uint32_t nCells = static_cast<uint32_t>(m_vCells.size());
+    uint32_t nCandidates = static_cast<uint32_t>(m_vCandidates.size());
+    uint64_t nSignature = signature();
+    outfile.write(reinterpret_cast<const char *>(&LOCATION_GRID_MAGIC), sizeof(LOCATION_GRID_MAGIC));
+    outfile.write(reinterpret_cast<const char *>(&LOCATION_GRID_VERSION), sizeof(LOCATION_GRID_VERSION));
+    outfile.write(reinterpret_cast<const char *>(&nSignature), sizeof(nSignature));
+    outfile.write(reinterpret_cast<const char *>(&m_nWidth), sizeof(m_nWidth));
+    outfile.write(reinterpret_cast<const char *>(&m_nHeight), sizeof(m_nHeight));
+    outfile.write(reinterpret_cast<const char *>(&nCells), sizeof(nCells));
+    outfile.write(reinterpret_cast<const char *>(m_vCells.data()), nCells * sizeof(int32_t));
+    outfile.write(reinterpret_cast<const char *>(&nCandidates), sizeof(nCandidates));
+    outfile.write(reinterpret_cast<const char *>(m_vCandidates.data()), nCandidates * sizeof(uint32_t));
+}
@@ -0,0 +1,60 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "Common.h"
+#include "MapLocationInfo.h"
+
+/// \brief Location id lookup on a fixed grid over the location polygons
+/// A cell that lies completely inside its best location stores that location id, a cell on a
+/// border stores the short list of polygons touching it, best priority first. Equal priorities
+/// keep the order the polygons were registered in.
+///
+/// Building walks every polygon over the cells of its bounding box, so the result is written
+/// to a cache file and reused as long as the polygons and the cell size did not change.
+class LocationGrid {
+public:
+    LocationGrid() = default;
+    ~LocationGrid() = default;
+    LocationGrid(const LocationGrid &) = delete;
+    LocationGrid &operator=(const LocationGrid &) = delete;
+
+    void AddLocation(const MapLocationInfo &info) { m_vLocations.emplace_back(info); }
+
+    /// \brief Loads the grid from szCacheFile, or builds and saves it when the cache does not match
+    void Initialize(const std::string &szCacheFile, float fCellSize);
+
+    bool IsReady() const { return !m_vCells.empty(); }
+
+    int32_t GetLocationID(float x, float y);
+
+private:
+    void build();
+    bool load(const std::string &szCacheFile);
+    void save(const std::string &szCacheFile) const;
+    uint64_t signature() const;
+    bool covers(MapLocationInfo &info, const X2D::RectangleF &rc);
+
+    std::vector<MapLocationInfo> m_vLocations{};
+
+    float m_fCellSize{256.0f};
+    uint32_t m_nWidth{0};
+    uint32_t m_nHeight{0};
+    // >= 0 is the location id of the whole cell, < 0 points to -value - 1 in m_vCandidates
+    std::vector<int32_t> m_vCells{};
+    // count followed by that many indices into m_vLocations
+    std::vector<uint32_t> m_vCandidates{};
+};
@@ -19,6 +19,7 @@
 
 #include <fstream>
 
+#include "Config.h"
 #include "FieldPropManager.h"
 #include "Log.h"
 #include "ObjectMgr.h"
@@ -73,6 +74,11 @@ bool Maploader::LoadMapContent()
             }
         }
     }
+
+    sObjectMgr.g_qtBlockInfo.Build();
+    if (g_qtLocationInfo != nullptr)
+        g_qtLocationInfo->Build();
+    m_LocationGrid.Initialize("Resource/NewMap/locationgrid.cache", static_cast<float>(std::max(sConfigMgr->GetIntDefault("World.LocationGridCellSize", 256), 16)));
     return true;
 }
 
@@ -94,6 +100,7 @@ void Maploader::RegisterMapLocationInfo(MapLocationInfo location_info)
     if (g_qtLocationInfo == nullptr) {
         g_qtLocationInfo = new X2D::QuadTreeMapInfo(g_nMapWidth, g_nMapHeight);
     }
+    m_LocationGrid.AddLocation(location_info);
     g_qtLocationInfo->Add(std::move(location_info));
 }
 
@@ -16,6 +16,7 @@
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "Common.h"
+#include "LocationGrid.h"
 #include "MapLocationInfo.h"
 #include "QuadTreeMapInfo.h"
 #include "TerrainPropInfo.h"
@@ -74,6 +75,7 @@ public:
 
     bool InitMapInfo();
     X2D::QuadTreeMapInfo *g_qtLocationInfo{nullptr};
+    LocationGrid m_LocationGrid{};
 
     std::vector<ScriptRegion> m_vRegionList{};
     std::vector<ScriptRegionInfo> m_vScriptEvent{};
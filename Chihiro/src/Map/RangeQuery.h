@@ -0,0 +1,145 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include <vector>
+
+#include "Common.h"
+
+/// \brief An object found by a range query, at its position at the time of the query
+struct RangeCandidate {
+    uint32_t handle;
+    float x;
+    float y;
+};
+
+/// \brief Positions of every object in the regions touched by a query, one array per coordinate
+/// The shapes test the arrays in plain loops without branches or square roots, which the
+/// compiler turns into SIMD code.
+struct RangeQueryBuffer {
+    void clear()
+    {
+        vHandle.clear();
+        vX.clear();
+        vY.clear();
+    }
+
+    std::vector<uint32_t> vHandle{};
+    std::vector<float> vX{};
+    std::vector<float> vY{};
+    std::vector<uint8_t> vMask{};
+};
+
+/// \brief Everything closer than fRange to the center, the border itself is outside
+struct RangeCircle {
+    RangeCircle(float _x, float _y, float fRange)
+        : x(_x)
+        , y(_y)
+        , range(fRange)
+        , rangeSq(fRange * fRange)
+    {
+    }
+
+    float Left() const { return x - range; }
+    float Top() const { return y - range; }
+    float Right() const { return x + range; }
+    float Bottom() const { return y + range; }
+
+    void Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const
+    {
+        for (std::size_t i = 0; i < nCount; ++i) {
+            float dx = pX[i] - x;
+            float dy = pY[i] - y;
+            pMask[i] = static_cast<uint8_t>(dx * dx + dy * dy < rangeSq);
+        }
+    }
+
+    float x;
+    float y;
+    float range;
+    float rangeSq;
+};
+
+/// \brief Everything inside the rectangle, borders included
+struct RangeRect {
+    RangeRect(float _left, float _top, float _right, float _bottom)
+        : left(_left)
+        , top(_top)
+        , right(_right)
+        , bottom(_bottom)
+    {
+    }
+
+    float Left() const { return left; }
+    float Top() const { return top; }
+    float Right() const { return right; }
+    float Bottom() const { return bottom; }
+
+    void Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const
+    {
+        for (std::size_t i = 0; i < nCount; ++i)
+            pMask[i] = static_cast<uint8_t>((pX[i] >= left) & (pX[i] <= right) & (pY[i] >= top) & (pY[i] <= bottom));
+    }
+
+    float left;
+    float top;
+    float right;
+    float bottom;
+};
+
+/// \brief The part of a circle within fAngle radians of the direction from the center to (tx, ty)
+/// Matches ArcCircleRegionTester::IsInRegion, the center itself and a target on the center count as inside.
+struct RangeArc {
+    RangeArc(float _x, float _y, float fRange, float tx, float ty, float fAngle)
+        : circle(_x, _y, fRange)
+        , cosine(std::cos(fAngle))
+        , cosineSq(cosine * cosine)
+    {
+        float dx = tx - _x;
+        float dy = ty - _y;
+        float m = std::sqrt(dx * dx + dy * dy);
+        dirX = m == 0 ? 1.0f : dx / m;
+        dirY = m == 0 ? 0.0f : dy / m;
+    }
+
+    float Left() const { return circle.Left(); }
+    float Top() const { return circle.Top(); }
+    float Right() const { return circle.Right(); }
+    float Bottom() const { return circle.Bottom(); }
+
+    void Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const
+    {
+        // cos(angle) >= cosine without dividing by the length: compare the squares and keep the signs
+        bool bNarrow = cosine >= 0;
+        for (std::size_t i = 0; i < nCount; ++i) {
+            float dx = pX[i] - circle.x;
+            float dy = pY[i] - circle.y;
+            float lengthSq = dx * dx + dy * dy;
+            float dot = dirX * dx + dirY * dy;
+            bool bFront = dot >= 0;
+            bool bWithin = dot * dot >= cosineSq * lengthSq;
+            bool bArc = bNarrow ? (bFront & bWithin) : (bFront | !bWithin);
+            pMask[i] = static_cast<uint8_t>((lengthSq < circle.rangeSq) & bArc);
+        }
+    }
+
+    RangeCircle circle;
+    float cosine;
+    float cosineSq;
+    float dirX;
+    float dirY;
+};
@@ -25,6 +25,7 @@ void RegionContainer::InitRegion(float map_width, float map_height)
 {
     m_MapWidth = map_width;
     m_MapHeight = map_height;
+    m_fRegionSize = static_cast<float>(sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE));
     m_nRegionWidth = (uint32_t)((map_width / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)) + 1.0f);
     m_nRegionHeight = (uint32_t)((map_height / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)) + 1.0f);
     m_nRegionBlockWidth = (m_nRegionWidth / REGION_BLOCK_COUNT) + 1;
@@ -257,6 +258,44 @@ Region *RegionContainer::getRegion(uint32_t rx, uint32_t ry, uint8_t layer)
     return nullptr;
 }
 
+void RegionContainer::gatherRange(float left, float top, float right, float bottom, uint8_t layer, uint8_t nBitset, uint32_t t, RangeQueryBuffer &buffer)
+{
+    if (m_fRegionSize <= 0 || right < 0 || bottom < 0)
+        return;
+
+    // Objects change their region on the next step only, so a moving one may still sit in a neighbour
+    auto toRegion = [this](float v, uint32_t nMax) { return std::min(static_cast<uint32_t>(std::max(v, 0.0f) / m_fRegionSize), nMax); };
+    uint32_t rx1 = toRegion(left, m_nRegionWidth - 1);
+    uint32_t ry1 = toRegion(top, m_nRegionHeight - 1);
+    uint32_t rx2 = std::min(toRegion(right, m_nRegionWidth - 1) + 1, m_nRegionWidth - 1);
+    uint32_t ry2 = std::min(toRegion(bottom, m_nRegionHeight - 1) + 1, m_nRegionHeight - 1);
+    rx1 = rx1 > 0 ? rx1 - 1 : 0;
+    ry1 = ry1 > 0 ? ry1 - 1 : 0;
+
+    auto gather = [&buffer, t](RegionType &vObjects) {
+        for (auto &obj : vObjects) {
+            auto pos = obj->GetCurrentPosition(t);
+            buffer.vHandle.emplace_back(obj->GetHandle());
+            buffer.vX.emplace_back(pos.GetPositionX());
+            buffer.vY.emplace_back(pos.GetPositionY());
+        }
+    };
+
+    for (uint32_t y = ry1; y <= ry2; ++y) {
+        for (uint32_t x = rx1; x <= rx2; ++x) {
+            Region *region = getRegionPtr(x, y, layer);
+            if (region == nullptr)
+                continue;
+            if ((nBitset & (uint8_t)RegionVisitor::ClientVisitor) != 0)
+                region->DoEachClient2(gather);
+            if ((nBitset & (uint8_t)RegionVisitor::MovableVisitor) != 0)
+                region->DoEachMovableObject2(gather);
+            if ((nBitset & (uint8_t)RegionVisitor::StaticVisitor) != 0)
+                region->DoEachStaticObject2(gather);
+        }
+    }
+}
+
 RegionContainer::~RegionContainer()
 {
     deinitRegion();
@@ -16,6 +16,7 @@
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "Common.h"
+#include "RangeQuery.h"
 #include "RegionBlock.h"
 #include "SharedMutex.h"
 
@@ -136,6 +137,34 @@ public:
         }
     }
 
+    /// \brief Collects the objects inside shape from the regions its bounding box touches
+    /// Objects are tested at their position at time t, nBitset is a mask of RegionVisitor.
+    template<typename Shape>
+    void EnumObjectsInRange(const Shape &shape, uint8_t layer, uint8_t nBitset, uint32_t t, std::vector<RangeCandidate> &vResult)
+    {
+        thread_local RangeQueryBuffer buffer{};
+        buffer.clear();
+        gatherRange(shape.Left(), shape.Top(), shape.Right(), shape.Bottom(), layer, nBitset, t, buffer);
+
+        auto nCount = buffer.vHandle.size();
+        buffer.vMask.resize(nCount);
+        shape.Test(buffer.vX.data(), buffer.vY.data(), buffer.vMask.data(), nCount);
+        for (std::size_t i = 0; i < nCount; ++i) {
+            if (buffer.vMask[i] != 0)
+                vResult.emplace_back(RangeCandidate{buffer.vHandle[i], buffer.vX[i], buffer.vY[i]});
+        }
+    }
+
+    /// \brief Calls fn(const RangeCandidate &) for every object inside shape, after all region locks are released
+    template<typename Shape, typename Fn>
+    void DoEachObjectInRange(const Shape &shape, uint8_t layer, uint8_t nBitset, uint32_t t, Fn &&fn)
+    {
+        std::vector<RangeCandidate> vResult{};
+        EnumObjectsInRange(shape, layer, nBitset, t, vResult);
+        for (const auto &candidate : vResult)
+            fn(candidate);
+    }
+
     uint32_t IsVisibleRegion(uint32_t rx, uint32_t ry, uint32_t _rx, uint32_t _ry);
     uint32_t IsVisibleRegion(WorldObject *obj1, WorldObject *obj2);
 
@@ -146,9 +175,11 @@ private:
     RegionBlock *getRegionBlock(uint32_t rcx, uint32_t rcy);
     Region *getRegionPtr(uint32_t rx, uint32_t ry, uint8_t layer);
     Region *getRegion(uint32_t rx, uint32_t ry, uint8_t layer);
+    void gatherRange(float left, float top, float right, float bottom, uint8_t layer, uint8_t nBitset, uint32_t t, RangeQueryBuffer &buffer);
 
     float m_MapWidth;
     float m_MapHeight;
+    float m_fRegionSize{0};
     uint32_t m_nRegionWidth;
     uint32_t m_nRegionHeight;
     uint32_t m_nRegionBlockWidth;
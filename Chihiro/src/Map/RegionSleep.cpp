@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RegionSleep.h"
+
+#include "Config.h"
+#include "HashMapHolder.h"
+#include "Monster.h"
+#include "Player.h"
+#include "RegionContainer.h"
+#include "World.h"
+
+void RegionSleepManager::InitializeRegionSleep()
+{
+    m_bEnabled = sConfigMgr->GetBoolDefault("World.RegionSleep", true);
+    m_nInterval = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.RegionSleepInterval", 10), 1));
+}
+
+void RegionSleepManager::Update()
+{
+    m_bSleepTick = false;
+    if (!m_bEnabled || ++m_nTick < m_nInterval)
+        return;
+    m_nTick = 0;
+    m_bSleepTick = true;
+
+    auto nRegionSize = sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE);
+    std::unordered_set<uint64_t> sAwake{};
+    {
+        NG_SHARED_GUARD readGuard(*HashMapHolder<Player>::GetLock());
+        for (auto &[handle, pPlayer] : HashMapHolder<Player>::GetContainer()) {
+            if (!pPlayer->IsInWorld())
+                continue;
+
+            auto rx = static_cast<uint32_t>(pPlayer->GetPositionX() / nRegionSize);
+            auto ry = static_cast<uint32_t>(pPlayer->GetPositionY() / nRegionSize);
+            for (uint32_t y = ry > VISIBLE_REGION_RANGE ? ry - VISIBLE_REGION_RANGE : 0; y <= ry + VISIBLE_REGION_RANGE; ++y) {
+                for (uint32_t x = rx > VISIBLE_REGION_RANGE ? rx - VISIBLE_REGION_RANGE : 0; x <= rx + VISIBLE_REGION_RANGE; ++x) {
+                    if (sRegion.IsVisibleRegion(rx, ry, x, y) != 0)
+                        sAwake.emplace(regionKey(x, y, pPlayer->GetLayer()));
+                }
+            }
+        }
+    }
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    m_sAwake.swap(sAwake);
+    for (auto nKey : m_sAwake) {
+        auto it = m_mSleeping.find(nKey);
+        if (it == m_mSleeping.end())
+            continue;
+        for (auto pMonster : it->second)
+            pMonster->m_bSleeping = false;
+        m_nSleeping -= static_cast<uint32_t>(it->second.size());
+        m_vWoken.insert(m_vWoken.end(), it->second.begin(), it->second.end());
+        m_mSleeping.erase(it);
+    }
+}
+
+bool RegionSleepManager::IsAwake(uint32_t rx, uint32_t ry, uint8_t layer)
+{
+    if (!m_bEnabled)
+        return true;
+
+    NG_SHARED_GUARD readGuard(i_lock);
+    return m_sAwake.count(regionKey(rx, ry, layer)) != 0;
+}
+
+bool RegionSleepManager::IsAwake(WorldObject *pObject)
+{
+    if (!m_bEnabled)
+        return true;
+
+    NG_SHARED_GUARD readGuard(i_lock);
+    return m_sAwake.count(regionKey(pObject)) != 0;
+}
+
+bool RegionSleepManager::IsAnyAwake(uint32_t rx1, uint32_t ry1, uint32_t rx2, uint32_t ry2, uint8_t layer)
+{
+    if (!m_bEnabled)
+        return true;
+
+    NG_SHARED_GUARD readGuard(i_lock);
+    for (uint32_t ry = ry1; ry <= ry2; ++ry) {
+        for (uint32_t rx = rx1; rx <= rx2; ++rx) {
+            if (m_sAwake.count(regionKey(rx, ry, layer)) != 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+void RegionSleepManager::Sleep(Monster *pMonster)
+{
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    if (pMonster->m_bSleeping)
+        return;
+
+    // Shown again once a player comes close
+    pMonster->m_bSleeping = true;
+    pMonster->m_bNearClient = false;
+    m_mSleeping[regionKey(pMonster)].emplace_back(pMonster);
+    ++m_nSleeping;
+}
+
+void RegionSleepManager::Wake(Monster *pMonster)
+{
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    if (!pMonster->m_bSleeping)
+        return;
+
+    // Sleeping monsters do not move, so they are still in the region they fell asleep in
+    auto it = m_mSleeping.find(regionKey(pMonster));
+    if (it != m_mSleeping.end()) {
+        auto &vMonsters = it->second;
+        auto pos = std::find(vMonsters.begin(), vMonsters.end(), pMonster);
+        if (pos != vMonsters.end()) {
+            *pos = vMonsters.back();
+            vMonsters.pop_back();
+        }
+        if (vMonsters.empty())
+            m_mSleeping.erase(it);
+    }
+
+    pMonster->m_bSleeping = false;
+    --m_nSleeping;
+    m_vWoken.emplace_back(pMonster);
+}
+
+void RegionSleepManager::TakeWoken(std::vector<Monster *> &vWoken)
+{
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    vWoken.swap(m_vWoken);
+}
+
+uint64_t RegionSleepManager::regionKey(WorldObject *pObject) const
+{
+    auto nRegionSize = sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE);
+    return regionKey(static_cast<uint32_t>(pObject->GetPositionX() / nRegionSize), static_cast<uint32_t>(pObject->GetPositionY() / nRegionSize), pObject->GetLayer());
+}
@@ -0,0 +1,89 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Common.h"
+#include "SharedMutex.h"
+
+class Monster;
+class WorldObject;
+
+/// \brief Puts monsters in regions no player can see to sleep
+/// Every World.RegionSleepInterval ticks the regions in visible range of a player are marked awake.
+/// On that tick the memory pool hands every idle monster outside of them to Sleep, which takes it
+/// out of the update list until a player comes close again. Respawners whose regions are all dormant
+/// wait as well and respawn at their usual pace again once one of the regions wakes.
+///
+/// A monster wakes with its region, when a player is shown it, or when it leaves the world.
+/// Woken monsters go back to the update list on the next memory pool update.
+class RegionSleepManager {
+public:
+    static RegionSleepManager &Instance()
+    {
+        static RegionSleepManager instance;
+        return instance;
+    }
+
+    ~RegionSleepManager() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    RegionSleepManager(const RegionSleepManager &) = delete;
+    RegionSleepManager &operator=(const RegionSleepManager &) = delete;
+
+    void InitializeRegionSleep();
+
+    /// \brief Marks the awake regions on every World.RegionSleepInterval tick and wakes their monsters
+    void Update();
+    /// \brief true on the ticks Update marked the awake regions
+    bool IsSleepTick() const { return m_bSleepTick; }
+
+    bool IsAwake(uint32_t rx, uint32_t ry, uint8_t layer);
+    bool IsAwake(WorldObject *pObject);
+    /// \brief true if any region from rx1/ry1 to rx2/ry2 is awake
+    bool IsAnyAwake(uint32_t rx1, uint32_t ry1, uint32_t rx2, uint32_t ry2, uint8_t layer);
+
+    /// \brief Takes pMonster out of the updates, the caller removes it from the update list
+    void Sleep(Monster *pMonster);
+    /// \brief Wakes pMonster if it is sleeping
+    void Wake(Monster *pMonster);
+    /// \brief Hands out the monsters woken since the last call
+    void TakeWoken(std::vector<Monster *> &vWoken);
+
+    uint32_t GetSleepingCount() const { return m_nSleeping; }
+
+private:
+    RegionSleepManager() = default;
+
+    uint64_t regionKey(uint32_t rx, uint32_t ry, uint8_t layer) const { return (static_cast<uint64_t>(layer) << 48) | (static_cast<uint64_t>(ry) << 24) | rx; }
+    uint64_t regionKey(WorldObject *pObject) const;
+
+    bool m_bEnabled{true};
+    uint32_t m_nInterval{10};
+    uint32_t m_nTick{0};
+    bool m_bSleepTick{false};
+
+    NG_SHARED_MUTEX i_lock;
+    std::unordered_set<uint64_t> m_sAwake{};
+    // Sleeping monsters by the region they fell asleep in
+    std::unordered_map<uint64_t, std::vector<Monster *>> m_mSleeping{};
+    std::vector<Monster *> m_vWoken{};
+    uint32_t m_nSleeping{0};
+};
+
+#define sRegionSleep RegionSleepManager::Instance()
@@ -17,6 +17,8 @@
 
 #include "RegionTester.h"
 
+#include "SkillBase.h"
+
 void DirectionRegionTester::Init(Position OriginalPos, Position TargetPos, float RegionProperty)
 {
     dx = TargetPos.GetPositionX() - OriginalPos.GetPositionX();
@@ -37,7 +39,7 @@ void DirectionRegionTester::Init(Position OriginalPos, Position TargetPos, float
     ori_y = OriginalPos.GetPositionY();
 }
 
-bool DirectionRegionTester::IsInRegion(Position pos)
+bool DirectionRegionTester::IsInRegion(Position pos) const
 {
     float dist = std::abs(-dy * pos.GetPositionX() + dx * pos.GetPositionY() + c) / denominator;
     if (thickness > dist) {
@@ -55,6 +57,18 @@ bool DirectionRegionTester::IsInRegion(Position pos)
     return false;
 }
 
+void DirectionRegionTester::Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const
+{
+    // Same as IsInRegion with the distance scaled by denominator, the origin itself is outside
+    float fLimit = thickness * denominator;
+    for (std::size_t i = 0; i < nCount; ++i) {
+        float fLine = std::abs(-dy * pX[i] + dx * pY[i] + c);
+        float _V2x = pX[i] - ori_x;
+        float _V2y = pY[i] - ori_y;
+        pMask[i] = static_cast<uint8_t>((fLine < fLimit) & (V1x * _V2x + V1y * _V2y >= 0) & (_V2x * _V2x + _V2y * _V2y > 0));
+    }
+}
+
 void CrossRegionTester::Init(Position OriginalPos, Position TargetPos, float RegionProperty)
 {
     x1 = TargetPos.GetPositionY() - OriginalPos.GetPositionY();
@@ -69,12 +83,19 @@ void CrossRegionTester::Init(Position OriginalPos, Position TargetPos, float Reg
     thickness = RegionProperty * 12.0f / 2;
 }
 
-bool CrossRegionTester::IsInRegion(Position pos)
+bool CrossRegionTester::IsInRegion(Position pos) const
 {
     return (thickness > (std::abs(x1 * pos.GetPositionX() + y1 * pos.GetPositionY() + c1) / denominator)) ||
         (thickness > (std::abs(x2 * pos.GetPositionX() + y2 * pos.GetPositionY() + c2) / denominator));
 }
 
+void CrossRegionTester::Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const
+{
+    float fLimit = thickness * denominator;
+    for (std::size_t i = 0; i < nCount; ++i)
+        pMask[i] = static_cast<uint8_t>((std::abs(x1 * pX[i] + y1 * pY[i] + c1) < fLimit) | (std::abs(x2 * pX[i] + y2 * pY[i] + c2) < fLimit));
+}
+
 void ArcCircleRegionTester::Init(Position OriginalPos, Position TargetPos, float RegionProperty)
 {
     float _V1x = TargetPos.GetPositionX() - OriginalPos.GetPositionX();
@@ -97,7 +118,7 @@ void ArcCircleRegionTester::Init(Position OriginalPos, Position TargetPos, float
     fCos = std::cos(RegionProperty);
 }
 
-bool ArcCircleRegionTester::IsInRegion(Position pos)
+bool ArcCircleRegionTester::IsInRegion(Position pos) const
 {
     float _V2x = pos.GetPositionX() - x;
     float _V2y = pos.GetPositionY() - y;
@@ -114,3 +135,30 @@ bool ArcCircleRegionTester::IsInRegion(Position pos)
 
     return fCos <= (V1x * V2x + V1y * V2y);
 }
+
+template<typename Tester>
+static void testRegion(Position OriginalPos, Position TargetPos, float RegionProperty, const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount)
+{
+    Tester tester{};
+    tester.Init(OriginalPos, TargetPos, RegionProperty);
+    tester.Test(pX, pY, pMask, nCount);
+}
+
+void TestSkillRegion(int32_t nRegionType, Position OriginalPos, Position TargetPos, float RegionProperty, const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount)
+{
+    switch (nRegionType) {
+    case REGION_TYPE_DIRECTION:
+        testRegion<DirectionRegionTester>(OriginalPos, TargetPos, RegionProperty, pX, pY, pMask, nCount);
+        break;
+    case REGION_TYPE_ARC_CIRCLE:
+        // Already filtered by the RangeArc range query
+        testRegion<CircleRegionTester>(OriginalPos, TargetPos, RegionProperty, pX, pY, pMask, nCount);
+        break;
+    case REGION_TYPE_CROSS:
+        testRegion<CrossRegionTester>(OriginalPos, TargetPos, RegionProperty, pX, pY, pMask, nCount);
+        break;
+    default:
+        testRegion<CircleRegionTester>(OriginalPos, TargetPos, RegionProperty, pX, pY, pMask, nCount);
+        break;
+    }
+}
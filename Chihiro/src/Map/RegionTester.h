@@ -15,17 +15,17 @@
  *  You should have received a copy of the GNU General Public License along
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
 #include <memory>
 
 #include "Object.h"
 
-struct RegionTester {
-    virtual void Init(Position OriginalPos, Position TargetPos, float RegionProperty) = 0;
-    virtual bool IsInRegion(Position pos) = 0;
-    virtual ~RegionTester() = default;
-};
+// Every tester has the same shape: Init once per skill, then IsInRegion for a single position or
+// Test for a whole batch. Test writes 1 into pMask for every position inside the region and is
+// written without branches or square roots so the loop vectorizes. Arcs are tested in batches by
+// RangeArc as part of the range query, so ArcCircleRegionTester has no Test of its own.
 
-struct DirectionRegionTester : public RegionTester {
+struct DirectionRegionTester {
     DirectionRegionTester()
         : V1x()
         , V1y()
@@ -39,8 +39,9 @@ struct DirectionRegionTester : public RegionTester {
 
           };
     ~DirectionRegionTester() = default;
-    void Init(Position OriginalPos, Position TargetPos, float RegionProperty) override;
-    bool IsInRegion(Position pos) override;
+    void Init(Position OriginalPos, Position TargetPos, float RegionProperty);
+    bool IsInRegion(Position pos) const;
+    void Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const;
 
     float V1x;
     float V1y;
@@ -53,7 +54,7 @@ struct DirectionRegionTester : public RegionTester {
     float denominator;
 };
 
-struct CrossRegionTester : public RegionTester {
+struct CrossRegionTester {
     CrossRegionTester()
         : x1()
         , y1()
@@ -64,8 +65,9 @@ struct CrossRegionTester : public RegionTester {
         , thickness()
         , denominator(){};
 
-    void Init(Position OriginalPos, Position TargetPos, float RegionProperty) override;
-    bool IsInRegion(Position pos) override;
+    void Init(Position OriginalPos, Position TargetPos, float RegionProperty);
+    bool IsInRegion(Position pos) const;
+    void Test(const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount) const;
 
     float x1;
     float y1;
@@ -77,7 +79,7 @@ struct CrossRegionTester : public RegionTester {
     float denominator;
 };
 
-struct ArcCircleRegionTester : public RegionTester {
+struct ArcCircleRegionTester {
     ArcCircleRegionTester()
         : V1x()
         , V1y()
@@ -87,8 +89,8 @@ struct ArcCircleRegionTester : public RegionTester {
 
           };
     ~ArcCircleRegionTester() = default;
-    void Init(Position OriginalPos, Position TargetPos, float RegionProperty) override;
-    bool IsInRegion(Position pos) override;
+    void Init(Position OriginalPos, Position TargetPos, float RegionProperty);
+    bool IsInRegion(Position pos) const;
 
     float V1x;
     float V1y;
@@ -97,8 +99,14 @@ struct ArcCircleRegionTester : public RegionTester {
     float fCos;
 };
 
-struct CircleRegionTester : public RegionTester {
-    void Init(Position OriginalPos, Position TargetPos, float RegionProperty) override {}
+struct CircleRegionTester {
+    void Init(Position OriginalPos, Position TargetPos, float RegionProperty) {}
+
+    bool IsInRegion(Position pos) const { return true; }
+
+    void Test(const float * /*pX*/, const float * /*pY*/, uint8_t *pMask, std::size_t nCount) const { std::fill_n(pMask, nCount, static_cast<uint8_t>(1)); }
+};
 
-    bool IsInRegion(Position pos) override { return true; }
-};
\ No newline at end of file
+/// \brief Tests a batch of positions against a skill region (REGION_TYPE), the tester is picked once per batch
+/// Unknown region types are plain circles and arcs are filtered by the range query, everything it returned is inside.
+void TestSkillRegion(int32_t nRegionType, Position OriginalPos, Position TargetPos, float RegionProperty, const float *pX, const float *pY, uint8_t *pMask, std::size_t nCount);
\ No newline at end of file
@@ -41,19 +41,21 @@ WorldLocation *WorldLocationManager::AddToLocation(uint32_t idx, Player *player)
     if (player->m_WorldLocation != nullptr)
         RemoveFromLocation(player);
 
-    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto wl = getLocation(idx);
+    if (wl == nullptr)
+        return nullptr;
 
-    auto wl = std::find_if(m_vWorldLocation.begin(), m_vWorldLocation.end(), [idx](const WorldLocation &worldLocation) { return worldLocation.idx == idx; });
-
-    if (wl != m_vWorldLocation.end()) {
+    {
+        std::lock_guard<std::mutex> writeGuard(wl->i_lock);
+        player->m_nWorldLocationSlot = static_cast<uint32_t>(wl->m_vIncludeClient.size());
         wl->m_vIncludeClient.emplace_back(player);
-        TS_SC_WEATHER_INFO weather_info{};
-        weather_info.region_id = idx;
-        weather_info.weather_id = wl->current_weather;
-        player->SendPacket(weather_info);
-        return &*wl;
     }
-    return nullptr;
+
+    TS_SC_WEATHER_INFO weather_info{};
+    weather_info.region_id = idx;
+    weather_info.weather_id = wl->current_weather;
+    player->SendPacket(weather_info);
+    return wl;
 }
 
 bool WorldLocationManager::RemoveFromLocation(Player *player)
@@ -61,15 +63,23 @@ bool WorldLocationManager::RemoveFromLocation(Player *player)
     if (player == nullptr || player->m_WorldLocation == nullptr)
         return false;
 
-    NG_UNIQUE_GUARD writeLock(i_lock);
-
-    auto wl = std::find_if(m_vWorldLocation.begin(), m_vWorldLocation.end(), [&player](const WorldLocation &worldLocation) { return player->m_WorldLocation->idx == worldLocation.idx; });
+    auto wl = player->m_WorldLocation;
+    std::lock_guard<std::mutex> writeGuard(wl->i_lock);
 
-    if (wl != m_vWorldLocation.end()) {
-        wl->m_vIncludeClient.erase(std::remove(wl->m_vIncludeClient.begin(), wl->m_vIncludeClient.end(), player), wl->m_vIncludeClient.end());
-        return true;
+    auto &vClients = wl->m_vIncludeClient;
+    auto nSlot = player->m_nWorldLocationSlot;
+    if (nSlot >= vClients.size() || vClients[nSlot] != player) {
+        auto it = std::find(vClients.begin(), vClients.end(), player);
+        if (it == vClients.end())
+            return false;
+        nSlot = static_cast<uint32_t>(std::distance(vClients.begin(), it));
     }
-    return false;
+
+    // Move the last client into the free slot
+    vClients[nSlot] = vClients.back();
+    vClients[nSlot]->m_nWorldLocationSlot = nSlot;
+    vClients.pop_back();
+    return true;
 }
 
 void WorldLocationManager::SendWeatherInfo(uint32_t idx, Player *player)
@@ -77,10 +87,8 @@ void WorldLocationManager::SendWeatherInfo(uint32_t idx, Player *player)
     if (player == nullptr)
         return;
 
-    NG_SHARED_GUARD readGuard(i_lock);
-    auto wl = std::find_if(m_vWorldLocation.begin(), m_vWorldLocation.end(), [idx](const WorldLocation &worldLocation) { return worldLocation.idx == idx; });
-
-    if (wl != m_vWorldLocation.end()) {
+    auto wl = getLocation(idx);
+    if (wl != nullptr) {
         TS_SC_WEATHER_INFO weatherPct{};
         weatherPct.region_id = idx;
         weatherPct.weather_id = wl->current_weather;
@@ -90,11 +98,8 @@ void WorldLocationManager::SendWeatherInfo(uint32_t idx, Player *player)
 
 int32_t WorldLocationManager::GetShovelableItem(uint32_t idx)
 {
-    NG_SHARED_GUARD readGuard(i_lock);
-
-    auto wl = std::find_if(m_vWorldLocation.begin(), m_vWorldLocation.end(), [idx](const WorldLocation &worldLocation) { return worldLocation.idx == idx; });
-
-    if (wl != m_vWorldLocation.end())
+    auto wl = getLocation(idx);
+    if (wl != nullptr)
         return wl->shovelable_item;
     return 0;
 }
@@ -106,10 +111,8 @@ uint32_t WorldLocationManager::GetShovelableMonster(uint32_t idx)
 
 void WorldLocationManager::RegisterWorldLocation(uint32_t idx, uint8_t location_type, uint32_t time_id, uint32_t weather_id, uint8_t ratio, uint32_t weather_change_time, int32_t shovelable_item)
 {
-
-    auto wl = std::find_if(m_vWorldLocation.begin(), m_vWorldLocation.end(), [idx](const WorldLocation &worldLocation) { return worldLocation.idx == idx; });
-
-    if (wl != m_vWorldLocation.end()) {
+    auto wl = getLocation(idx);
+    if (wl != nullptr) {
         wl->weather_ratio[weather_id][time_id] = ratio;
         wl->shovelable_item = shovelable_item;
         return;
@@ -122,9 +125,18 @@ void WorldLocationManager::RegisterWorldLocation(uint32_t idx, uint8_t location_
     nwl.weather_change_time = weather_change_time;
     nwl.shovelable_item = shovelable_item;
 
+    m_mLocationIndex[idx] = m_vWorldLocation.size();
     m_vWorldLocation.emplace_back(nwl);
 }
 
+WorldLocation *WorldLocationManager::getLocation(uint32_t idx)
+{
+    auto pos = m_mLocationIndex.find(idx);
+    if (pos == m_mLocationIndex.end())
+        return nullptr;
+    return &m_vWorldLocation[pos->second];
+}
+
 void WorldLocationManager::RegisterMonsterLocation(uint32_t idx, uint32_t monster_id)
 {
     std::vector<uint32_t> ml{};
@@ -15,8 +15,9 @@
  *  You should have received a copy of the GNU General Public License along
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <mutex>
+
 #include "Common.h"
-#include "SharedMutex.h"
 
 class Player;
 
@@ -59,11 +60,14 @@ public:
     uint32_t idx{};
     uint8_t location_type{};
     uint8_t weather_ratio[7][4]{};
-    uint8_t current_weather{};
+    uint8_t current_weather{}; // set while loading, there is no weather cycle yet
     uint32_t weather_change_time{};
     uint32_t last_changed_time{};
     int32_t shovelable_item{};
-    std::vector<Player *> m_vIncludeClient{};
+
+    // Guards the client list, every location has its own so players moving between locations do not wait on each other
+    mutable std::mutex i_lock;
+    std::vector<Player *> m_vIncludeClient{}; // Player::m_nWorldLocationSlot is the position in here
 };
 
 class WorldLocationManager {
@@ -75,6 +79,10 @@ public:
     }
 
     ~WorldLocationManager() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    WorldLocationManager(const WorldLocationManager &) = delete;
+    WorldLocationManager &operator=(const WorldLocationManager &) = delete;
 
     WorldLocation *AddToLocation(uint32_t idx, Player *player);
     bool RemoveFromLocation(Player *player);
@@ -85,8 +93,12 @@ public:
     void RegisterMonsterLocation(uint32_t idx, uint32_t monster_id);
 
 private:
-    NG_SHARED_MUTEX i_lock;
+    WorldLocation *getLocation(uint32_t idx);
+
+    // Filled while loading the game content and never changed afterwards, so lookups go without a lock
+    // and the WorldLocation pointers handed out stay valid
     std::vector<WorldLocation> m_vWorldLocation{};
+    std::unordered_map<uint32_t, std::size_t> m_mLocationIndex{}; // idx -> m_vWorldLocation
     std::unordered_map<uint32_t, std::vector<uint32_t>> m_hsMonsterID{};
 
 protected:
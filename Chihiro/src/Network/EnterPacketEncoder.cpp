@@ -0,0 +1,216 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EnterPacketEncoder.h"
+
+#include <algorithm>
+
+#include "ClientPackets.h"
+#include "FieldProp.h"
+#include "Item.h"
+#include "Messages.h"
+#include "Monster.h"
+#include "NPC.h"
+#include "Player.h"
+#include "SkillProp/SkillProp.h"
+#include "Summon.h"
+#include "World.h"
+
+namespace {
+    struct EncoderContext {
+        XPacket scratch{};           // the packet being encoded
+        XPacket info{};              // rebuilding a cached info
+        XPacket burst{};             // packets of the running burst
+        Player *pReceiver{nullptr};  // receiver of the running burst
+        uint32_t nDepth{0};
+    };
+
+    thread_local EncoderContext t_context{};
+} // namespace
+
+EnterPacketEncoder::Burst::Burst(Player *pReceiver)
+{
+    if (pReceiver == nullptr || (t_context.nDepth != 0 && t_context.pReceiver != pReceiver))
+        return;
+
+    if (t_context.nDepth++ == 0) {
+        t_context.pReceiver = pReceiver;
+        t_context.burst.clear();
+    }
+    m_bActive = true;
+}
+
+EnterPacketEncoder::Burst::~Burst()
+{
+    if (!m_bActive || --t_context.nDepth != 0)
+        return;
+
+    if (!t_context.burst.empty())
+        t_context.pReceiver->SendPacketBatch(t_context.burst);
+    t_context.burst.clear();
+    t_context.pReceiver = nullptr;
+}
+
+void EnterPacketEncoder::SendEnter(Player *pReceiver, WorldObject *pObject)
+{
+    if (pReceiver == nullptr || pObject == nullptr)
+        return;
+
+    int32_t nVersion = sConfigMgr->getCachedConfig().packetVersion;
+
+    // The mount is shown before its rider
+    if (pObject->IsPlayer()) {
+        auto pPlayer = pObject->As<Player>();
+        if (pPlayer->GetRideHandle() != 0) {
+            auto pRide = pPlayer->GetRideObject();
+            if (pRide != nullptr)
+                Messages::sendEnterMessage(pReceiver, pRide, true);
+        }
+    }
+
+    auto &packet = t_context.scratch;
+    auto pos = pObject->GetCurrentPosition(sWorld.GetArTime());
+    packet.Initialize(TS_SC_ENTER::getId(nVersion));
+    packet.Reset();
+    // The head of TS_SC_ENTER_DEF, none of it depends on the version
+    packet << static_cast<uint8_t>(pObject->GetMainType()) << pObject->GetHandle() << pos.GetPositionX() << pos.GetPositionY() << pos.GetPositionZ() << pObject->GetLayer()
+           << static_cast<uint8_t>(pObject->GetSubType());
+
+    switch (pObject->GetSubType()) {
+    case ST_Player:
+    case ST_NPC:
+    case ST_Summon:
+    case ST_Mob:
+        writeCreatureInfo(packet, pObject, pReceiver, nVersion);
+        break;
+    case ST_Object: {
+        TS_SC_ENTER enterPct{};
+        Item::EnterPacket(enterPct, pObject->As<Item>());
+        MessageSerializerBuffer serializer(&packet, nVersion);
+        serializer.write("itemInfo", enterPct.itemInfo);
+        break;
+    }
+    case ST_FieldProp: {
+        TS_SC_ENTER enterPct{};
+        FieldProp::EnterPacket(enterPct, pObject->As<FieldProp>(), pReceiver);
+        MessageSerializerBuffer serializer(&packet, nVersion);
+        serializer.write("fieldPropInfo", enterPct.fieldPropInfo);
+        break;
+    }
+    case ST_SkillProp: {
+        TS_SC_ENTER enterPct{};
+        SkillProp::EnterPacket(enterPct, pObject->As<SkillProp>(), pReceiver);
+        MessageSerializerBuffer serializer(&packet, nVersion);
+        serializer.write("skillInfo", enterPct.skillInfo);
+        break;
+    }
+    default:
+        break;
+    }
+
+    packet.FinalizePacket();
+    sendEncoded(pReceiver, packet);
+}
+
+void EnterPacketEncoder::Forget(WorldObject *pObject)
+{
+    if (pObject == nullptr)
+        return;
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    m_mCache.erase(pObject->GetHandle());
+}
+
+bool EnterPacketEncoder::isBursting(Player *pReceiver)
+{
+    return t_context.nDepth != 0 && t_context.pReceiver == pReceiver;
+}
+
+XPacket &EnterPacketEncoder::scratchBuffer()
+{
+    return t_context.scratch;
+}
+
+void EnterPacketEncoder::appendToBurst(const XPacket &packet)
+{
+    t_context.burst.append(packet.contents(), packet.size());
+}
+
+void EnterPacketEncoder::sendEncoded(Player *pReceiver, const XPacket &packet)
+{
+    if (isBursting(pReceiver))
+        appendToBurst(packet);
+    else
+        pReceiver->SendPacketBatch(packet);
+}
+
+void EnterPacketEncoder::writeCreatureInfo(XPacket &packet, WorldObject *pObject, Player *pReceiver, int32_t nVersion)
+{
+    // Status and hp/mp change all the time and the status depends on the receiver
+    TS_SC_ENTER__CREATURE_INFO creatureInfo{};
+    Unit::EnterPacket(creatureInfo, pObject->As<Unit>(), pReceiver);
+    MessageSerializerBuffer serializer(&packet, nVersion);
+    serializer.write("creatureInfo", creatureInfo);
+
+    uint32_t nRideHandle = pObject->IsPlayer() ? pObject->As<Player>()->GetRideHandle() : 0;
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto &info = m_mCache[pObject->GetHandle()];
+    if (info.vBytes.empty() || info.nRevision != pObject->GetValuesRevision() || info.nRideHandle != nRideHandle || info.nVersion != nVersion) {
+        buildCachedInfo(info, pObject, pReceiver, nVersion);
+        info.nRideHandle = nRideHandle;
+    }
+    packet.append(info.vBytes.data(), info.vBytes.size());
+}
+
+void EnterPacketEncoder::buildCachedInfo(CachedInfo &info, WorldObject *pObject, Player *pReceiver, int32_t nVersion)
+{
+    TS_SC_ENTER enterPct{};
+    auto &buffer = t_context.info;
+    buffer.clear();
+    MessageSerializerBuffer serializer(&buffer, nVersion);
+
+    switch (pObject->GetSubType()) {
+    case ST_Player:
+        Player::EnterPacket(enterPct, pObject->As<Player>(), pReceiver);
+        serializer.write("playerInfo", enterPct.playerInfo);
+        break;
+    case ST_NPC:
+        NPC::EnterPacket(enterPct, pObject->As<NPC>(), pReceiver);
+        serializer.write("npcInfo", enterPct.npcInfo);
+        break;
+    case ST_Summon:
+        Summon::EnterPacket(enterPct, pObject->As<Summon>(), pReceiver);
+        serializer.write("summonInfo", enterPct.summonInfo);
+        break;
+    case ST_Mob:
+        Monster::EnterPacket(enterPct, pObject->As<Monster>(), pReceiver);
+        serializer.write("monsterInfo", enterPct.monsterInfo);
+        break;
+    default:
+        break;
+    }
+
+    // Everything behind the creature info, which is written fresh for every enter
+    auto nOffset = std::min<std::size_t>(TS_SC_ENTER__CREATURE_INFO{}.getSize(nVersion), buffer.size());
+    if (nOffset < buffer.size())
+        info.vBytes.assign(buffer.contents() + nOffset, buffer.contents() + buffer.size());
+    else
+        info.vBytes.clear();
+    info.nRevision = pObject->GetValuesRevision();
+    info.nVersion = nVersion;
+}
@@ -0,0 +1,103 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "MessageSerializerBuffer.h"
+#include "SharedMutex.h"
+
+class Player;
+class WorldObject;
+
+/// \brief Writes TS_SC_ENTER straight into a reusable buffer of the calling thread
+/// The part of a creature's info that does not depend on the receiver or on hp/mp (template id,
+/// name, appearance) is serialized once and kept per object until one of its values changes.
+///
+/// Within a Burst every enter, wear info and move sent to its receiver by the same thread is
+/// collected back to back and queued on the socket as one buffer when the Burst ends, so a
+/// teleport into a crowded town does not allocate per visible object.
+class EnterPacketEncoder {
+public:
+    static EnterPacketEncoder &Instance()
+    {
+        static EnterPacketEncoder instance;
+        return instance;
+    }
+
+    ~EnterPacketEncoder() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    EnterPacketEncoder(const EnterPacketEncoder &) = delete;
+    EnterPacketEncoder &operator=(const EnterPacketEncoder &) = delete;
+
+    /// \brief Collects the packets for pReceiver sent by this thread until it goes out of scope
+    /// Nested bursts for the same receiver join the outer one, a burst for another receiver does nothing.
+    class Burst {
+    public:
+        explicit Burst(Player *pReceiver);
+        ~Burst();
+        Burst(const Burst &) = delete;
+        Burst &operator=(const Burst &) = delete;
+
+    private:
+        bool m_bActive{false};
+    };
+
+    void SendEnter(Player *pReceiver, WorldObject *pObject);
+
+    /// \brief Adds packet to the running burst of pReceiver
+    /// \return false if this thread has no burst for pReceiver and the caller has to send it
+    template<class TS_SERIALIZABLE_PACKET>
+    bool Append(Player *pReceiver, const TS_SERIALIZABLE_PACKET &packet)
+    {
+        if (!isBursting(pReceiver))
+            return false;
+
+        auto &scratch = scratchBuffer();
+        SerializePacket(packet, &scratch, sConfigMgr->getCachedConfig().packetVersion);
+        appendToBurst(scratch);
+        return true;
+    }
+
+    /// \brief Drops the cached info of an object that left the world
+    void Forget(WorldObject *pObject);
+
+private:
+    EnterPacketEncoder() = default;
+
+    struct CachedInfo {
+        uint32_t nRevision{0};
+        uint32_t nRideHandle{0};
+        int32_t nVersion{0};
+        std::vector<uint8_t> vBytes{}; // the creature info fields after TS_SC_ENTER__CREATURE_INFO
+    };
+
+    static bool isBursting(Player *pReceiver);
+    static XPacket &scratchBuffer();
+    static void appendToBurst(const XPacket &packet);
+    static void sendEncoded(Player *pReceiver, const XPacket &packet);
+
+    void writeCreatureInfo(XPacket &packet, WorldObject *pObject, Player *pReceiver, int32_t nVersion);
+    void buildCachedInfo(CachedInfo &info, WorldObject *pObject, Player *pReceiver, int32_t nVersion);
+
+    NG_SHARED_MUTEX i_lock;
+    std::unordered_map<uint32_t, CachedInfo> m_mCache{}; // object handle -> static part of its info
+};
+
+#define sEnterPacketEncoder EnterPacketEncoder::Instance()
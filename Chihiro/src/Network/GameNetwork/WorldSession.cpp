@@ -26,8 +26,10 @@
 #include "GameContent.h"
 #include "GameRule.h"
 #include "GroupManager.h"
+#include "InterestManager.h"
 #include "MemPool.h"
 #include "Messages.h"
+#include "Metrics.h"
 #include "MixManager.h"
 #include "NPC.h"
 #include "ObjectMgr.h"
@@ -42,6 +44,8 @@ WorldSession::WorldSession(boost::asio::ip::tcp::socket &&socket)
     : XSocket(std::move(socket))
     , m_nLastPing(sWorld.GetArTime())
 {
+    // Everything sent during a world tick leaves as one write at its end, see XSocket::FlushSendBatches
+    SetBatchedSend(sConfigMgr->GetBoolDefault("Network.BatchSends", true));
 }
 
 // Close patch file descriptor before leaving
@@ -55,8 +59,19 @@ void WorldSession::OnClose()
 {
     if (_accountName.length() > 0)
         sAuthNetwork.SendClientLogoutToAuth(_accountName);
-    if (m_pPlayer)
+    if (m_pPlayer) {
+        // The logout save has to land before the character list of the next login reads it
+        DatabaseWorkerPool<CharacterDatabaseConnection>::OrderScope order(_accountId);
         onReturnToLobby(nullptr);
+    }
+}
+
+bool WorldSession::IsUrgentPacket(uint16_t packetId) const
+{
+    auto version = sConfigMgr->getCachedConfig().packetVersion;
+    // The client measures its latency with the time packets, the others answer a login the client waits on
+    return packetId == TS_TIMESYNC::getId(version) || packetId == TS_SC_GAME_TIME::getId(version) || packetId == TS_SC_LOGIN_RESULT::getId(version) ||
+        packetId == TS_SC_DISCONNECT_DESC::getId(version);
 }
 
 std::string WorldSession::GetAccountName() const
@@ -70,6 +85,7 @@ typedef struct WorldSessionHandler {
     int32_t cmd;
     eStatus status;
     std::function<void(WorldSession *, XPacket *)> handler;
+    NGemity::Metrics::Histogram *handlerTime;
 } WorldSessionHandler;
 
 template<typename T>
@@ -78,6 +94,7 @@ WorldSessionHandler declareHandler(eStatus status, void (WorldSession::*handler)
     WorldSessionHandler handlerData{};
     handlerData.cmd = T::getId(EPIC_4_1_1);
     handlerData.status = status;
+    handlerData.handlerTime = &sMetrics.GetHistogram(NGemity::StringFormat("network.handler_us.{}", T::getName()));
     handlerData.handler = [handler](WorldSession *instance, XPacket *packet) -> void {
         T deserializedPacket;
         MessageSerializerBuffer buffer(packet);
@@ -145,9 +162,12 @@ ReadDataHandlerResult WorldSession::ProcessIncoming(XPacket *pRecvPct)
 
     auto _cmd = pRecvPct->GetPacketID();
     int32_t i = 0;
+    // Reads of the account queue behind its pending saves, e.g. the character list behind the items of a new character
+    DatabaseWorkerPool<CharacterDatabaseConnection>::OrderScope order(_accountId);
 
     for (i = 0; i < worldTableSize; i++) {
         if ((uint16_t)worldPacketHandler[i].cmd == _cmd && (worldPacketHandler[i].status == STATUS_CONNECTED || (_isAuthed && worldPacketHandler[i].status == STATUS_AUTHED))) {
+            NGemity::Metrics::ScopedTimer handlerTimer(*worldPacketHandler[i].handlerTime);
             worldPacketHandler[i].handler(this, pRecvPct);
             break;
         }
@@ -178,53 +198,72 @@ void WorldSession::_SendResultMsg(uint16_t _msg, uint16_t _result, int32_t _valu
     SendPacket(resultPct);
 }
 
+namespace {
+    // Shared by the steps of the character list query chain
+    struct CharacterListRequest {
+        TS_SC_CHARACTER_LIST characterPct{};
+        std::vector<int32_t> vCharacterSid{}; // same order as characterPct.characters
+    };
+} // namespace
+
 void WorldSession::onCharacterList(const TS_CS_CHARACTER_LIST * /*pGamePct*/)
 {
-    TS_SC_CHARACTER_LIST characterPct{};
-    characterPct.current_server_time = sWorld.GetArTime();
-    characterPct.last_character_idx = 0;
-    _PrepareCharacterList(_accountId, &characterPct.characters);
-    SendPacket(characterPct);
-}
+    auto request = std::make_shared<CharacterListRequest>();
+    request->characterPct.last_character_idx = 0;
 
-/// TODO: Might need to put this in player class?
-void WorldSession::_PrepareCharacterList(uint32_t account_id, std::vector<LOBBY_CHARACTER_INFO> *_info)
-{
     PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_GET_CHARACTERLIST);
-    stmt->setInt32(0, account_id);
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt)) {
-        do {
-            LOBBY_CHARACTER_INFO info{};
-            int32_t sid = (*result)[0].GetInt32();
-            info.name = (*result)[1].GetString();
-            info.race = (*result)[2].GetInt32();
-            info.sex = (*result)[3].GetInt32();
-            info.level = (*result)[4].GetInt32();
-            info.job_level = (*result)[5].GetInt32();
-            info.exp_percentage = (*result)[6].GetInt32();
-            info.hp = (*result)[7].GetInt32();
-            info.mp = (*result)[8].GetInt32();
-            info.job = (*result)[9].GetInt32();
-            info.permission = (*result)[10].GetInt32();
-            info.skin_color = (*result)[11].GetUInt32();
-            for (int32_t i = 0; i < 5; i++) {
-                info.model_id[i] = (*result)[12 + i].GetInt32();
-            }
-            info.szCreateTime = (*result)[17].GetString();
-            info.szDeleteTime = (*result)[18].GetString();
-            PreparedStatement *wstmt = CharacterDatabase.GetPreparedStatement(CHARACTER_GET_WEARINFO);
-            wstmt->setInt32(0, sid);
-            if (PreparedQueryResult wresult = CharacterDatabase.Query(wstmt)) {
-                do {
-                    int32_t wear_info = (*wresult)[0].GetInt32();
-                    info.wear_info[wear_info] = (*wresult)[1].GetInt32();
-                    info.wear_item_enhance_info[wear_info] = (*wresult)[2].GetInt32();
-                    info.wear_item_level_info[wear_info] = (*wresult)[3].GetInt32();
-                } while (wresult->NextRow());
-            }
-            _info->emplace_back(info);
-        } while (result->NextRow());
-    }
+    stmt->setInt32(0, _accountId);
+    // Characters first, then what all of them are wearing in one go
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt)
+                         .WithChainingPreparedCallback([this, request](QueryCallback &callback, PreparedQueryResult result) {
+                             if (!result) {
+                                 request->characterPct.current_server_time = sWorld.GetArTime();
+                                 SendPacket(request->characterPct);
+                                 return;
+                             }
+
+                             do {
+                                 LOBBY_CHARACTER_INFO info{};
+                                 request->vCharacterSid.emplace_back((*result)[0].GetInt32());
+                                 info.name = (*result)[1].GetString();
+                                 info.race = (*result)[2].GetInt32();
+                                 info.sex = (*result)[3].GetInt32();
+                                 info.level = (*result)[4].GetInt32();
+                                 info.job_level = (*result)[5].GetInt32();
+                                 info.exp_percentage = (*result)[6].GetInt32();
+                                 info.hp = (*result)[7].GetInt32();
+                                 info.mp = (*result)[8].GetInt32();
+                                 info.job = (*result)[9].GetInt32();
+                                 info.permission = (*result)[10].GetInt32();
+                                 info.skin_color = (*result)[11].GetUInt32();
+                                 for (int32_t i = 0; i < 5; i++) {
+                                     info.model_id[i] = (*result)[12 + i].GetInt32();
+                                 }
+                                 info.szCreateTime = (*result)[17].GetString();
+                                 info.szDeleteTime = (*result)[18].GetString();
+                                 request->characterPct.characters.emplace_back(info);
+                             } while (result->NextRow());
+
+                             PreparedStatement *wstmt = CharacterDatabase.GetPreparedStatement(CHARACTER_GET_WEARINFO);
+                             wstmt->setInt32(0, _accountId);
+                             callback.SetNextQuery(CharacterDatabase.AsyncQuery(wstmt));
+                         })
+                         .WithPreparedCallback([this, request](PreparedQueryResult wresult) {
+                             if (wresult) {
+                                 do {
+                                     auto itr = std::find(request->vCharacterSid.begin(), request->vCharacterSid.end(), (*wresult)[0].GetInt32());
+                                     if (itr == request->vCharacterSid.end())
+                                         continue;
+                                     auto &info = request->characterPct.characters[std::distance(request->vCharacterSid.begin(), itr)];
+                                     int32_t wear_info = (*wresult)[1].GetInt32();
+                                     info.wear_info[wear_info] = (*wresult)[2].GetInt32();
+                                     info.wear_item_enhance_info[wear_info] = (*wresult)[3].GetInt32();
+                                     info.wear_item_level_info[wear_info] = (*wresult)[4].GetInt32();
+                                 } while (wresult->NextRow());
+                             }
+                             request->characterPct.current_server_time = sWorld.GetArTime();
+                             SendPacket(request->characterPct);
+                         }));
 }
 
 void WorldSession::onAuthResult(const TS_AG_CLIENT_LOGIN *pRecvPct)
@@ -294,8 +333,9 @@ bool GetValidWayPoint(Player *pClient, Unit *pMObj, const TS_CS_MOVE_REQUEST *pM
         return false;
     }
 
+    // Moves are tested without the line of sight cache, its snapped line ends could let a player through a thin wall
     if (pMObj->IsPlayer()) {
-        if (GameContent::CollisionToLine(curPosFromServer.GetPositionX(), curPosFromServer.GetPositionY(), wayPoint.GetPositionX(), wayPoint.GetPositionY())) {
+        if (sObjectMgr.g_qtBlockInfo.LooseCollision({{curPosFromServer.GetPositionX(), curPosFromServer.GetPositionY()}, {wayPoint.GetPositionX(), wayPoint.GetPositionY()}})) {
             Messages::SendResult(pClient, pMsg->getReceivedId(), TS_RESULT_ACCESS_DENIED, 0);
 
             if (GameContent::IsBlocked(curPosFromServer.GetPositionX(), curPosFromServer.GetPositionY()))
@@ -315,7 +355,7 @@ bool GetValidWayPoint(Player *pClient, Unit *pMObj, const TS_CS_MOVE_REQUEST *pM
         }
 
         if (pMObj->IsPlayer()) {
-            if (GameContent::CollisionToLine(wayPoint.GetPositionX(), wayPoint.GetPositionY(), mv.tx, mv.ty)) {
+            if (sObjectMgr.g_qtBlockInfo.LooseCollision({{wayPoint.GetPositionX(), wayPoint.GetPositionY()}, {mv.tx, mv.ty}})) {
                 Messages::SendResult(pClient, pMsg->getReceivedId(), TS_RESULT_ACCESS_DENIED, 0);
                 if (GameContent::IsBlocked(curPosFromServer.GetPositionX(), curPosFromServer.GetPositionY()))
                     return false;
@@ -461,99 +501,105 @@ void WorldSession::onRequestReturnToLobby(const TS_CS_REQUEST_RETURN_LOBBY *pRec
 
 void WorldSession::onCreateCharacter(const TS_CS_CREATE_CHARACTER *pRecvPct)
 {
-    if (checkCharacterName(pRecvPct->character.name)) {
-        uint8_t j = 0;
-        PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_CHARACTER);
-        stmt->setString(j++, pRecvPct->character.name);
-        stmt->setString(j++, _accountName);
-        stmt->setInt32(j++, _accountId);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, pRecvPct->character.race);
-        stmt->setInt32(j++, pRecvPct->character.sex);
-        stmt->setInt32(j++, 0);
-        stmt->setInt32(j++, pRecvPct->character.job);
-        stmt->setInt32(j++, pRecvPct->character.job_level);
-        stmt->setInt32(j++, pRecvPct->character.exp_percentage);
-        stmt->setInt32(j++, 320);
-        stmt->setInt32(j++, 320);
-        stmt->setUInt32(j++, pRecvPct->character.skin_color);
-        for (const auto &i : pRecvPct->character.model_id) {
-            stmt->setUInt32(j++, i);
+    checkCharacterName(pRecvPct->character.name, [this, info = pRecvPct->character, nRequestMsgId = pRecvPct->getReceivedId()](bool bAvailable) {
+        if (!bAvailable) {
+            _SendResultMsg(nRequestMsgId, TS_RESULT_ALREADY_EXIST, 0);
+            return;
         }
-        auto playerUID = sWorld.GetPlayerIndex();
-        stmt->setUInt32(j, playerUID);
-        CharacterDatabase.Query(stmt);
-
-        int32_t m_wear_item = pRecvPct->character.wear_info[2];
-        int32_t nDefaultBagCode = 490001;
-        int32_t nDefaultArmorCode = 220100;
+        createCharacter(info, nRequestMsgId);
+    });
+}
+
+void WorldSession::createCharacter(const LOBBY_CHARACTER_INFO &info, uint16_t nRequestMsgId)
+{
+    uint8_t j = 0;
+    PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_CHARACTER);
+    stmt->setString(j++, info.name);
+    stmt->setString(j++, _accountName);
+    stmt->setInt32(j++, _accountId);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, info.race);
+    stmt->setInt32(j++, info.sex);
+    stmt->setInt32(j++, 0);
+    stmt->setInt32(j++, info.job);
+    stmt->setInt32(j++, info.job_level);
+    stmt->setInt32(j++, info.exp_percentage);
+    stmt->setInt32(j++, 320);
+    stmt->setInt32(j++, 320);
+    stmt->setUInt32(j++, info.skin_color);
+    for (const auto &i : info.model_id) {
+        stmt->setUInt32(j++, i);
+    }
+    auto playerUID = sWorld.GetPlayerIndex();
+    stmt->setUInt32(j, playerUID);
+    auto trans = CharacterDatabase.BeginTransaction();
+    trans->Append(stmt);
+
+    int32_t m_wear_item = info.wear_info[2];
+    int32_t nDefaultBagCode = 490001;
+    int32_t nDefaultArmorCode = 220100;
+    if (m_wear_item == 602)
+        nDefaultArmorCode = 220109;
+
+    int32_t nDefaultWeaponCode = 106100;
+    if (info.race == 3) {
+        nDefaultArmorCode = 240100;
         if (m_wear_item == 602)
-            nDefaultArmorCode = 220109;
-
-        int32_t nDefaultWeaponCode = 106100;
-        if (pRecvPct->character.race == 3) {
-            nDefaultArmorCode = 240100;
+            nDefaultArmorCode = 240109;
+        nDefaultWeaponCode = 112100;
+    }
+    else {
+        if (info.race == 5) {
+            nDefaultArmorCode = 230100;
             if (m_wear_item == 602)
-                nDefaultArmorCode = 240109;
-            nDefaultWeaponCode = 112100;
-        }
-        else {
-            if (pRecvPct->character.race == 5) {
-                nDefaultArmorCode = 230100;
-                if (m_wear_item == 602)
-                    nDefaultArmorCode = 230109;
-                nDefaultWeaponCode = 103100;
-            }
+                nDefaultArmorCode = 230109;
+            nDefaultWeaponCode = 103100;
         }
+    }
 
-        auto itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
-        itemStmt->setInt32(0, sWorld.GetItemIndex());
-        itemStmt->setInt32(1, playerUID);
-        itemStmt->setInt32(2, nDefaultWeaponCode);
-        itemStmt->setInt32(3, WEAR_WEAPON);
-        CharacterDatabase.Execute(itemStmt);
+    auto itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
+    itemStmt->setInt32(0, sWorld.GetItemIndex());
+    itemStmt->setInt32(1, playerUID);
+    itemStmt->setInt32(2, nDefaultWeaponCode);
+    itemStmt->setInt32(3, WEAR_WEAPON);
+    trans->Append(itemStmt);
 
-        itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
-        itemStmt->setInt32(0, sWorld.GetItemIndex());
-        itemStmt->setInt32(1, playerUID);
-        itemStmt->setInt32(2, nDefaultArmorCode);
-        itemStmt->setInt32(3, WEAR_ARMOR);
-        CharacterDatabase.Execute(itemStmt);
+    itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
+    itemStmt->setInt32(0, sWorld.GetItemIndex());
+    itemStmt->setInt32(1, playerUID);
+    itemStmt->setInt32(2, nDefaultArmorCode);
+    itemStmt->setInt32(3, WEAR_ARMOR);
+    trans->Append(itemStmt);
 
-        itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
-        itemStmt->setInt32(0, sWorld.GetItemIndex());
-        itemStmt->setInt32(1, playerUID);
-        itemStmt->setInt32(2, nDefaultBagCode);
-        itemStmt->setInt32(3, WEAR_BAG_SLOT);
-        CharacterDatabase.Execute(itemStmt);
+    itemStmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_DEFAULT_ITEM);
+    itemStmt->setInt32(0, sWorld.GetItemIndex());
+    itemStmt->setInt32(1, playerUID);
+    itemStmt->setInt32(2, nDefaultBagCode);
+    itemStmt->setInt32(3, WEAR_BAG_SLOT);
+    trans->Append(itemStmt);
 
-        _SendResultMsg(pRecvPct->getReceivedId(), TS_RESULT_SUCCESS, 0);
-        return;
-    }
-    _SendResultMsg(pRecvPct->getReceivedId(), TS_RESULT_ALREADY_EXIST, 0);
+    // The character and its default items are committed together, a failed insert leaves neither behind
+    AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans).AfterComplete([this, nRequestMsgId](bool bCommitted) {
+        _SendResultMsg(nRequestMsgId, bCommitted ? TS_RESULT_SUCCESS : TS_RESULT_DB_ERROR, 0);
+    }));
 }
 
-bool WorldSession::checkCharacterName(const std::string &szName)
+void WorldSession::checkCharacterName(const std::string &szName, std::function<void(bool)> &&fnResult)
 {
     PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_GET_NAMECHECK);
     stmt->setString(0, szName);
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt)) {
-        return false;
-    }
-    return true;
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([fnResult = std::move(fnResult)](PreparedQueryResult result) { fnResult(result == nullptr); }));
 }
 
 void WorldSession::onCharacterName(const TS_CS_CHECK_CHARACTER_NAME *pRecvPct)
 {
-    if (!checkCharacterName(pRecvPct->name)) {
-        _SendResultMsg(pRecvPct->getReceivedId(), TS_RESULT_ALREADY_EXIST, 0);
-        return;
-    }
-    _SendResultMsg(pRecvPct->getReceivedId(), TS_RESULT_SUCCESS, 0);
+    checkCharacterName(pRecvPct->name, [this, nRequestMsgId = pRecvPct->getReceivedId()](bool bAvailable) {
+        _SendResultMsg(nRequestMsgId, bAvailable ? TS_RESULT_SUCCESS : TS_RESULT_ALREADY_EXIST, 0);
+    });
 }
 
 void WorldSession::onChatRequest(const TS_CS_CHAT_REQUEST *pRectPct)
@@ -849,7 +895,7 @@ void WorldSession::onQuery(const TS_CS_QUERY *pRecvPct)
 {
     auto obj = sMemoryPool.GetObjectInWorld<WorldObject>(pRecvPct->handle);
     if (obj != nullptr && obj->IsInWorld() && obj->GetLayer() == m_pPlayer->GetLayer() && sRegion.IsVisibleRegion(obj, m_pPlayer) != 0) {
-        Messages::sendEnterMessage(m_pPlayer, obj, false);
+        sInterestManager.ShowNow(m_pPlayer, obj);
     }
 }
 
@@ -1385,6 +1431,26 @@ bool WorldSession::Update(uint32_t /*diff*/)
     return true;
 }
 
+bool WorldSession::Update()
+{
+    {
+        // Query callbacks chain further queries of the account
+        DatabaseWorkerPool<CharacterDatabaseConnection>::OrderScope order(_accountId);
+        m_QueryProcessor.ProcessReadyQueries();
+    }
+    return XSocket::Update();
+}
+
+void WorldSession::AddQueryCallback(QueryCallback &&callback)
+{
+    m_QueryProcessor.AddQuery(std::move(callback));
+}
+
+void WorldSession::AddTransactionCallback(TransactionCallback &&callback)
+{
+    m_QueryProcessor.AddTransaction(std::move(callback));
+}
+
 void WorldSession::onRevive(const TS_CS_RESURRECTION *pRecvPct)
 {
     if (m_pPlayer == nullptr)
@@ -18,6 +18,7 @@
 #include "Common.h"
 #include "Encryption/XRc4Cipher.h"
 #include "Log.h"
+#include "QueryCallbackProcessor.h"
 #include "XSocket.h"
 
 enum STORAGE_MODE : int {
@@ -44,8 +45,20 @@ public:
     void OnClose() override;
     void KickPlayer();
     bool Update(uint32_t diff);
+    /// \brief Socket update on the network thread, also runs the callbacks of finished queries
+    bool Update() override;
+
+    /// \brief Keeps an async query of this session until its result is there
+    /// The callbacks run on this session's network thread, the same one running the packet handlers,
+    /// and are dropped unrun if the session goes away first.
+    /// Example:
+    ///     AddQueryCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([this](PreparedQueryResult result) { ... }));
+    void AddQueryCallback(QueryCallback &&callback);
+    /// \brief Same as AddQueryCallback for an AsyncCommitTransaction
+    void AddTransactionCallback(TransactionCallback &&callback);
 
     ReadDataHandlerResult ProcessIncoming(XPacket *) override;
+    bool IsUrgentPacket(uint16_t packetId) const override;
 
     uint32_t GetAccountId() const { return _accountId; }
 
@@ -122,10 +135,12 @@ public:
     void onStorage(const TS_CS_STORAGE *);
 
     void _SendResultMsg(uint16_t, uint16_t, int32_t);
-    void _PrepareCharacterList(uint32_t, std::vector<LOBBY_CHARACTER_INFO> *);
 
 private:
-    bool checkCharacterName(const std::string &);
+    /// \brief Looks up a character name without blocking
+    /// \param fnResult called with true if the name is still free
+    void checkCharacterName(const std::string &szName, std::function<void(bool)> &&fnResult);
+    void createCharacter(const LOBBY_CHARACTER_INFO &info, uint16_t nRequestMsgId);
     bool isValidTradeTarget(Player *);
 
     uint32_t m_nLastPing{0};
@@ -134,4 +149,5 @@ private:
     Player *m_pPlayer{nullptr};
     bool _isAuthed{false};
     int32_t m_nPermission;
+    QueryCallbackProcessor m_QueryProcessor{};
 };
\ No newline at end of file
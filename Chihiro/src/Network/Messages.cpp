@@ -18,12 +18,15 @@
 #include "Messages.h"
 
 #include "ClientPackets.h"
+#include "EnterPacketEncoder.h"
 #include "GroupManager.h"
 #include "MemPool.h"
 #include "NPC.h"
 #include "ObjectMgr.h"
 #include "RegionContainer.h"
+#include "RegionSleep.h"
 #include "Skill.h"
+#include "UnitUpdateAggregator.h"
 #include "World.h"
 #include "WorldSession.h"
 
@@ -397,6 +400,7 @@ void Messages::sendEnterMessage(Player *pPlayer, WorldObject *pObj, bool /* bAbs
 
     if (pObj->IsMonster()) {
         pObj->As<Monster>()->m_bNearClient = true;
+        sRegionSleep.Wake(pObj->As<Monster>());
     }
 
     pObj->SendEnterMsg(pPlayer);
@@ -422,7 +426,8 @@ void Messages::SendMoveMessage(Player *pPlayer, Unit *pUnit)
             move_info.ty = pos.end.GetPositionY();
             movePct.move_infos.emplace_back(move_info);
         }
-        pPlayer->SendPacket(movePct);
+        if (!sEnterPacketEncoder.Append(pPlayer, movePct))
+            pPlayer->SendPacket(movePct);
     }
 }
 
@@ -442,10 +447,17 @@ void Messages::SendWearInfo(Player *pPlayer, Unit *pUnit)
         wearPct.item_enhance[i] = pUnit->m_anWear[i] != nullptr ? pUnit->m_anWear[i]->GetItemInstance().GetEnhance() : 0;
         wearPct.item_level[i] = pUnit->m_anWear[i] != nullptr ? pUnit->m_anWear[i]->GetItemInstance().GetLevel() : 0;
     }
-    pPlayer->SendPacket(wearPct);
+    if (!sEnterPacketEncoder.Append(pPlayer, wearPct))
+        pPlayer->SendPacket(wearPct);
 }
 
 void Messages::BroadcastHPMPMessage(Unit *pUnit, int32_t add_hp, float add_mp, bool need_to_display)
+{
+    if (!sUnitUpdateAggregator.AddHPMP(pUnit, add_hp, add_mp, need_to_display))
+        BroadcastHPMPMessageNow(pUnit, add_hp, add_mp, need_to_display);
+}
+
+void Messages::BroadcastHPMPMessageNow(Unit *pUnit, int32_t add_hp, float add_mp, bool need_to_display)
 {
     TS_SC_HPMP hpmpPct{};
     hpmpPct.handle = pUnit->GetHandle();
@@ -755,6 +767,15 @@ void Messages::SendQuestList(Player *pPlayer)
 }
 
 void Messages::BroadcastStatusMessage(WorldObject *obj)
+{
+    if (obj == nullptr)
+        return;
+
+    if (!sUnitUpdateAggregator.AddStatus(obj))
+        BroadcastStatusMessageNow(obj);
+}
+
+void Messages::BroadcastStatusMessageNow(WorldObject *obj)
 {
     if (obj == nullptr)
         return;
@@ -794,7 +815,9 @@ void Messages::BroadcastStateMessage(Unit *pUnit, State *pState, bool bIsCancel)
     statePct.state_value = pState->m_nStateValue;
     statePct.state_string_value = pState->m_szStateValue;
 
-    sWorld.Broadcast(pUnit->GetRX(), pUnit->GetRY(), pUnit->GetLayer(), statePct);
+    // The packet is complete here, pState may be gone by the time it is flushed
+    if (!sUnitUpdateAggregator.AddState(pUnit, statePct))
+        sWorld.Broadcast(pUnit->GetRX(), pUnit->GetRY(), pUnit->GetLayer(), statePct);
 }
 
 void Messages::BroadcastTamingMessage(Player *pPlayer, Monster *pMonster, int32_t mode)
@@ -64,9 +64,12 @@ public:
     static void SendMoveMessage(Player *, Unit *);
     static void SendTimeSynch(Player *);
     static void SendWearInfo(Player *, Unit *);
+    // Queued in the UnitUpdateAggregator and sent once per unit at the end of the tick
     static void BroadcastHPMPMessage(Unit *, int, float, bool need_to_display = false);
+    static void BroadcastHPMPMessageNow(Unit *, int, float, bool need_to_display);
     static void BroadcastLevelMsg(Unit *);
     static void BroadcastStatusMessage(WorldObject *obj);
+    static void BroadcastStatusMessageNow(WorldObject *obj);
     static void BroadcastStateMessage(Unit *pUnit, State *pState, bool bIsCancel);
     static void BroadcastTamingMessage(Player *pPlayer, Monster *pMonster, int32_t mode);
     static void SendStateMessage(Player *pPlayer, uint32_t handle, State *pState, bool bIsCancel);
@@ -232,7 +232,7 @@ bool Quest::IsFinishable() const
     return false;
 }
 
-void Quest::DB_Insert(Player *pPlayer, Quest *pQuest)
+void Quest::DB_Insert(Player *pPlayer, Quest *pQuest, BatchStatement *pBatch)
 {
     PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_ADD_QUEST);
     stmt->setInt32(0, pPlayer->GetUInt32Value(UNIT_FIELD_UID));
@@ -243,5 +243,8 @@ void Quest::DB_Insert(Player *pPlayer, Quest *pQuest)
     stmt->setInt32(5, pQuest->m_Instance.nStatus[1]);
     stmt->setInt32(6, pQuest->m_Instance.nStatus[2]);
     stmt->setInt32(7, (int32_t)pQuest->m_Instance.nProgress);
-    CharacterDatabase.Execute(stmt);
+    if (pBatch != nullptr)
+        pBatch->Append(stmt);
+    else
+        CharacterDatabase.Execute(stmt);
 }
\ No newline at end of file
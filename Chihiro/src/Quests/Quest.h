@@ -18,6 +18,7 @@
 #include "Common.h"
 #include "QuestBase.h"
 
+class BatchStatement;
 class Quest;
 class Player;
 struct QuestEventHandler {
@@ -29,7 +30,7 @@ class Quest {
 public:
     static Quest *AllocQuest(QuestEventHandler *handler, int32_t nID, int32_t code, const int32_t status[], QuestProgress progress, int32_t nStartID);
     static bool IsRandomQuest(int32_t code);
-    static void DB_Insert(Player *pPlayer, Quest *pQuest);
+    static void DB_Insert(Player *pPlayer, Quest *pQuest, BatchStatement *pBatch = nullptr);
 
     Quest() = default;
     ~Quest() = default;
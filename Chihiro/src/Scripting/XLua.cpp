@@ -31,11 +31,38 @@
 XLua::XLua()
 {
     m_pState.open_libraries(sol::lib::base, sol::lib::math, sol::lib::string, sol::lib::package);
+    m_nMaxCachedChunks = (size_t)sConfigMgr->GetIntDefault("Scripting.ChunkCacheSize", 4096);
 }
 
+XLua::BytecodeMap XLua::s_vContentBytecode{};
+
 bool XLua::InitializeLua()
 {
+    int32_t nFiles = loadScripts();
+    if (!runServerInit(true))
+        return false;
+    NG_LOG_INFO("server.scripting", "Loaded %d files.", nFiles);
+    return true;
+}
+
+bool XLua::runServerInit(bool bSetupWorld)
+{
+    m_bSetupWorld = bSetupWorld;
+    bool bResult{true};
+    try {
+        m_pState.script("on_server_init()");
+    }
+    catch (sol::error &ex) {
+        NG_LOG_ERROR("server.scripting", "%s", ex.what());
+        bResult = false;
+    }
+    m_bSetupWorld = true;
+    return bResult;
+}
 
+int32_t XLua::loadScripts()
+{
+    m_bLoaded = true;
     auto configFile = std::filesystem::path(ConfigMgr::instance()->GetCorrectPath("Resource/Script/"));
 
     // Monster relevant
@@ -121,14 +148,98 @@ bool XLua::InitializeLua()
             }
         }
     }
-    try {
-        m_pState.script("on_server_init()");
+    return nFiles;
+}
+
+static int32_t writeBytecode(lua_State * /*L*/, const void *p, size_t sz, void *ud)
+{
+    reinterpret_cast<std::string *>(ud)->append(reinterpret_cast<const char *>(p), sz);
+    return 0;
+}
+
+void XLua::PrecompileContentScripts()
+{
+    auto oldTime = getMSTime();
+    int32_t nErrors{0};
+    sObjectMgr.EnumContentScripts([this, &nErrors](const std::string &szLua) {
+        if (szLua.empty() || szLua == "0" || m_vContentChunks.count(szLua) != 0)
+            return;
+
+        sol::load_result chunk = m_pState.load(szLua);
+        if (!chunk.valid()) {
+            sol::error err = chunk;
+            NG_LOG_ERROR("server.scripting", "Failed to compile \"%s\": %s", szLua.c_str(), err.what());
+            nErrors++;
+            return;
+        }
+        sol::protected_function func = chunk.get<sol::protected_function>();
+        std::string szBytecode{};
+        sol::stack::push(m_pState.lua_state(), func);
+        lua_dump(m_pState.lua_state(), &writeBytecode, &szBytecode, 0);
+        lua_pop(m_pState.lua_state(), 1);
+
+        s_vContentBytecode.emplace(szLua, std::move(szBytecode));
+        m_vContentChunks.emplace(szLua, std::move(func));
+    });
+    NG_LOG_INFO("server.scripting", "Precompiled %u content scripts (%d failed) in %u ms.", (uint32_t)m_vContentChunks.size(), nErrors, GetMSTimeDiffToNow(oldTime));
+}
+
+const sol::protected_function *XLua::findChunk(const std::string &szLua) const
+{
+    auto itr = m_vContentChunks.find(szLua);
+    if (itr != m_vContentChunks.end())
+        return &itr->second;
+    itr = m_vChunkCache.find(szLua);
+    if (itr != m_vChunkCache.end())
+        return &itr->second;
+    return nullptr;
+}
+
+bool XLua::runChunk(const std::string &szLua, std::string &szError)
+{
+    if (!m_bLoaded) {
+        int32_t nFiles = loadScripts();
+        runServerInit(false);
+        NG_LOG_DEBUG("server.scripting", "Created thread local lua state, loaded %d files.", nFiles);
     }
-    catch (sol::error &ex) {
-        NG_LOG_ERROR("server.scripting", "%s", ex.what());
+
+    // Work on a copy, the chunk may run scripts itself and flush the cache while it is executing
+    sol::protected_function chunk{};
+    if (const sol::protected_function *pChunk = findChunk(szLua); pChunk != nullptr) {
+        chunk = *pChunk;
+    }
+    else if (auto itr = s_vContentBytecode.find(szLua); itr != s_vContentBytecode.end()) {
+        // Content script precompiled by the world thread, only needs to be brought into this state
+        sol::load_result loaded = m_pState.load(itr->second, szLua, sol::load_mode::binary);
+        if (!loaded.valid()) {
+            sol::error err = loaded;
+            szError = err.what();
+            return false;
+        }
+        chunk = loaded.get<sol::protected_function>();
+        m_vContentChunks.emplace(szLua, chunk);
+    }
+    else {
+        sol::load_result loaded = m_pState.load(szLua);
+        if (!loaded.valid()) {
+            sol::error err = loaded;
+            szError = err.what();
+            return false;
+        }
+        chunk = loaded.get<sol::protected_function>();
+        // Scripts with formatted arguments (on_login, on_first_summon, ...) are unique per call,
+        // drop everything instead of tracking usage so the hot ones get back in quickly
+        if (m_vChunkCache.size() >= m_nMaxCachedChunks)
+            m_vChunkCache.clear();
+        m_vChunkCache.emplace(szLua, chunk);
+    }
+
+    sol::protected_function_result result = chunk();
+    if (!result.valid()) {
+        sol::error err = result;
+        szError = err.what();
         return false;
     }
-    NG_LOG_INFO("server.scripting", "Loaded %d files.", nFiles);
     return true;
 }
 
@@ -139,12 +250,10 @@ bool XLua::RunString(Unit *pObject, std::string szLua, std::string &szResult)
     if (szLua == "0")
         return true;
 
-    try {
-        m_pState.script(szLua);
-    }
-    catch (std::exception &ex) {
-        Messages::SendChatMessage(50, "@SCRIPT", m_pUnit->As<Player>(), ex.what());
-        NG_LOG_ERROR("server.scripting", "%s", ex.what());
+    std::string szError{};
+    if (!runChunk(szLua, szError)) {
+        Messages::SendChatMessage(50, "@SCRIPT", m_pUnit->As<Player>(), szError);
+        NG_LOG_ERROR("server.scripting", "%s", szError.c_str());
     }
     return true;
 }
@@ -157,11 +266,9 @@ bool XLua::RunString(Unit *pObject, std::string pScript)
 
 bool XLua::RunString(std::string szScript)
 {
-    try {
-        m_pState.script(szScript);
-    }
-    catch (sol::error &err) {
-        NG_LOG_ERROR("server.scripting", "%s", err.what());
+    std::string szError{};
+    if (!runChunk(szScript, szError)) {
+        NG_LOG_ERROR("server.scripting", "%s", szError.c_str());
         return false;
     }
     return true;
@@ -169,17 +276,21 @@ bool XLua::RunString(std::string szScript)
 
 void XLua::SCRIPT_SetWayPointType(int32_t waypoint_id, int32_t waypoint_type)
 {
+    if (!m_bSetupWorld)
+        return;
     sObjectMgr.SetWayPointType(waypoint_id, waypoint_type);
 }
 
 void XLua::SCRIPT_AddWayPoint(int32_t waypoint_id, int32_t x, int32_t y)
 {
+    if (!m_bSetupWorld)
+        return;
     sObjectMgr.AddWayPoint(waypoint_id, x, y);
 }
 
 void XLua::SCRIPT_RespawnRareMob(sol::variadic_args args)
 {
-    if (args.size() < 7)
+    if (!m_bSetupWorld || args.size() < 7)
         return;
 
     uint32_t id = args[0].get<int32_t>();
@@ -719,7 +830,7 @@ uint32_t XLua::SCRIPT_InsertItem(sol::variadic_args args)
 
 void XLua::SCRIPT_AddRespawnInfo(sol::variadic_args args)
 {
-    if (args.size() < 9)
+    if (!m_bSetupWorld || args.size() < 9)
         return;
 
     auto id = args[0].get<uint32_t>();
@@ -743,6 +854,8 @@ void XLua::SCRIPT_CPrint(sol::variadic_args) {}
 
 void XLua::SCRIPT_AddMonster(int32_t x, int32_t y, int32_t id, int32_t amount)
 {
+    if (!m_bSetupWorld)
+        return;
     for (int32_t i = 0; i < amount; i++) {
         auto mob = GameContent::RespawnMonster((float)x, (float)y, 0, id, true, 0, nullptr, false);
         mob->m_bNearClient = true;
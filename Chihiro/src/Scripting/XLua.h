@@ -19,11 +19,18 @@
 #include "sol.hpp"
 
 class Unit;
+/// Every thread that runs scripts owns its own XLua instance with a separate lua state,
+/// so world and network threads never share an interpreter. The world thread runs
+/// InitializeLua, other threads load the script files lazily on their first RunString and
+/// pull content chunks from the bytecode compiled at startup. Every state runs on_server_init
+/// once so its lua globals match, but only the world thread's run registers respawns, way
+/// points and NPCs. Data changed at runtime that has to be seen by all threads must be stored
+/// through the SCRIPT_* bindings (flags, values, ...) and not in lua globals.
 class XLua {
 public:
     static XLua &Instance()
     {
-        static XLua instance;
+        static thread_local XLua instance;
         return instance;
     }
 
@@ -38,7 +45,26 @@ public:
     bool RunString(Unit *, std::string);
     bool RunString(std::string);
 
+    /// \brief Compiles every script string known from the loaded game content ahead of time
+    /// Has to be called on the world thread before the network is started
+    void PrecompileContentScripts();
+
 private:
+    typedef std::unordered_map<std::string, sol::protected_function> ChunkCache;
+    typedef std::unordered_map<std::string, std::string> BytecodeMap;
+
+    /// \brief Registers the SCRIPT_* bindings and runs all script files in this thread's state
+    /// \return number of files loaded
+    int32_t loadScripts();
+    /// \brief Runs on_server_init in this thread's state, bSetupWorld is false when replaying it for a thread local state
+    bool runServerInit(bool bSetupWorld);
+
+    /// \brief Runs szLua through the chunk cache, compiling it on first use
+    /// \param szError Lua error message on failure
+    /// \return false if compiling or running the chunk failed
+    bool runChunk(const std::string &szLua, std::string &szError);
+    const sol::protected_function *findChunk(const std::string &szLua) const;
+
     template<typename T>
     sol::object return_object(T &&value)
     {
@@ -133,6 +159,19 @@ private:
 
     Unit *m_pUnit{nullptr};
     sol::state m_pState{};
+    bool m_bLoaded{false};
+    // false while a thread local state replays on_server_init, the world was set up by the world thread
+    bool m_bSetupWorld{true};
+
+    // Content scripts as lua bytecode, shared by all threads.
+    // Filled once by PrecompileContentScripts and read-only afterwards, hence no lock.
+    static BytecodeMap s_vContentBytecode;
+
+    // Content scripts loaded into this state, never evicted
+    ChunkCache m_vContentChunks{};
+    // Chunks compiled on demand, cleared once it holds m_nMaxCachedChunks entries
+    ChunkCache m_vChunkCache{};
+    size_t m_nMaxCachedChunks{0};
 
 protected:
     XLua();
@@ -94,7 +94,7 @@ void Skill::SetRequestedSkillLevel(int nLevel)
     m_nRequestedSkillLevel = (uint8_t)tl;
 }
 
-void Skill::DB_InsertSkill(Unit *pUnit, int64_t skillUID, int skill_id, int skill_level, int cool_time)
+void Skill::DB_InsertSkill(Unit *pUnit, int64_t skillUID, int skill_id, int skill_level, int cool_time, BatchStatement *pBatch)
 {
     auto owner_uid = pUnit->GetUInt32Value(UNIT_FIELD_UID);
     PreparedStatement *stmt = CharacterDatabase.GetPreparedStatement(CHARACTER_REP_SKILL);
@@ -104,7 +104,10 @@ void Skill::DB_InsertSkill(Unit *pUnit, int64_t skillUID, int skill_id, int skil
     stmt->setInt32(3, skill_id);
     stmt->setInt32(4, skill_level);
     stmt->setInt32(5, cool_time);
-    CharacterDatabase.Execute(stmt);
+    if (pBatch != nullptr)
+        pBatch->Append(stmt);
+    else
+        CharacterDatabase.Execute(stmt);
 }
 
 void Skill::AddSkillDamageResult(std::vector<SkillResult> &pvList, uint8_t type, int damageType, DamageInfo damageInfo, uint32_t handle)
@@ -174,6 +177,28 @@ void Skill::AddSkillDamageWithKnockBackResult(
     pvList.emplace_back(skillResult);
 }
 
+/// \brief Bounding box of the part of a direction region within fRange of the origin
+/// A line skill fired along an axis touches a narrow band of regions instead of the whole circle.
+static RangeRect directionRegionBounds(const Position &OriginalPos, const Position &TargetPos, float fRange, float fRegionProperty)
+{
+    float x = OriginalPos.GetPositionX();
+    float y = OriginalPos.GetPositionY();
+    float dx = TargetPos.GetPositionX() - x;
+    float dy = TargetPos.GetPositionY() - y;
+    float m = std::sqrt(dx * dx + dy * dy);
+    if (m == 0)
+        return RangeRect{x - fRange, y - fRange, x + fRange, y + fRange};
+
+    // Same half width as DirectionRegionTester
+    float fThickness = fRegionProperty * 12.0f / 2;
+    float ux = dx / m * fRange;
+    float uy = dy / m * fRange;
+    float px = std::abs(dy / m * fThickness);
+    float py = std::abs(dx / m * fThickness);
+    return RangeRect{std::max(x - fRange, std::min(x, x + ux) - px), std::max(y - fRange, std::min(y, y + uy) - py), std::min(x + fRange, std::max(x, x + ux) + px),
+        std::min(y + fRange, std::max(y, y + uy) + py)};
+}
+
 int Skill::EnumSkillTargetsAndCalcDamage(const Position &_OriginalPos, uint8_t layer, const Position &_TargetPos, bool bTargetOrigin, const float fEffectLength, const int nRegionType,
     const float fRegionProperty, const int nOriginalDamage, const bool bIncludeOriginalPos, Unit *pCaster, const int nDistributeType, const int nTargetMax, /*out*/ std::vector<Unit *> &vTargetList,
     bool bEnemyOnly)
@@ -183,35 +208,60 @@ int Skill::EnumSkillTargetsAndCalcDamage(const Position &_OriginalPos, uint8_t l
     auto OriginalPos = bTargetOrigin ? _TargetPos : _OriginalPos;
     auto TargetPos = bTargetOrigin ? _OriginalPos : _TargetPos;
 
-    std::vector<uint32_t> vList{};
-    sWorld.EnumMovableObject(OriginalPos, layer, fEffectLength, vList);
-
-    vTargetList.clear();
-
-    RegionTester *pTester{nullptr};
-
-    ArcCircleRegionTester RegionTester_ArcCircle{};
-    DirectionRegionTester RegionTester_Direction{};
-    CrossRegionTester RegionTester_Cross{};
-    CircleRegionTester RegionTester_Circle{};
-
+    // An arc is tested together with the range, a direction is searched in its bounding box and the other shapes on the circle's result
+    std::vector<RangeCandidate> vList{};
     if (nRegionType == REGION_TYPE_ARC_CIRCLE)
-        pTester = &RegionTester_ArcCircle;
+        sWorld.EnumMovableObject(RangeArc{OriginalPos.GetPositionX(), OriginalPos.GetPositionY(), fEffectLength, TargetPos.GetPositionX(), TargetPos.GetPositionY(), fRegionProperty}, layer, vList);
     else if (nRegionType == REGION_TYPE_DIRECTION)
-        pTester = &RegionTester_Direction;
-    else if (nRegionType == REGION_TYPE_CROSS)
-        pTester = &RegionTester_Cross;
+        sWorld.EnumMovableObject(directionRegionBounds(OriginalPos, TargetPos, fEffectLength, fRegionProperty), layer, vList);
     else
-        pTester = &RegionTester_Circle;
+        sWorld.EnumMovableObject(RangeCircle{OriginalPos.GetPositionX(), OriginalPos.GetPositionY(), fEffectLength}, layer, vList);
 
-    pTester->Init(OriginalPos, TargetPos, fRegionProperty);
+    vTargetList.clear();
+
+    // The region is tested for the whole batch before any object is looked up
+    auto nCount = vList.size();
+    std::vector<float> vPositions(nCount * 2);
+    std::vector<uint8_t> vInRegion(nCount);
+    for (std::size_t i = 0; i < nCount; ++i) {
+        vPositions[i] = vList[i].x;
+        vPositions[nCount + i] = vList[i].y;
+    }
+    TestSkillRegion(nRegionType, OriginalPos, TargetPos, fRegionProperty, vPositions.data(), vPositions.data() + nCount, vInRegion.data(), nCount);
+    if (nRegionType == REGION_TYPE_DIRECTION) {
+        // The corners of the bounding box reach past the range
+        std::vector<uint8_t> vInRange(nCount);
+        RangeCircle{OriginalPos.GetPositionX(), OriginalPos.GetPositionY(), fEffectLength}.Test(vPositions.data(), vPositions.data() + nCount, vInRange.data(), nCount);
+        for (std::size_t i = 0; i < nCount; ++i)
+            vInRegion[i] &= vInRange[i];
+    }
+
+    // Targets behind a wall are dropped, the lines of everything left in the region are tested in one go
+    std::vector<std::size_t> vInRegionIndex{};
+    for (std::size_t i = 0; i < nCount; ++i) {
+        if (vInRegion[i] != 0) {
+            vPositions[vInRegionIndex.size()] = vPositions[i];
+            vPositions[nCount + vInRegionIndex.size()] = vPositions[nCount + i];
+            vInRegionIndex.emplace_back(i);
+        }
+    }
+    std::vector<uint8_t> vBlocked(vInRegionIndex.size());
+    GameContent::CollisionToLines(OriginalPos.GetPositionX(), OriginalPos.GetPositionY(), vPositions.data(), vPositions.data() + nCount, vBlocked.data(), vInRegionIndex.size());
+    for (std::size_t i = 0; i < vInRegionIndex.size(); ++i) {
+        if (vBlocked[i] != 0)
+            vInRegion[vInRegionIndex[i]] = 0;
+    }
 
     int32_t nTargetCount = 0;
     int32_t nAllyCount = 0;
 
-    for (auto &handle : vList) {
+    auto t = sWorld.GetArTime();
+    for (std::size_t i = 0; i < nCount; ++i) {
+        if (vInRegion[i] == 0)
+            continue;
+
         bool bIsAlly = false;
-        auto *pObj = sMemoryPool.GetObjectInWorld<WorldObject>(handle);
+        auto *pObj = sMemoryPool.GetObjectInWorld<WorldObject>(vList[i].handle);
 
         if (pObj == nullptr)
             continue;
@@ -229,11 +279,7 @@ int Skill::EnumSkillTargetsAndCalcDamage(const Position &_OriginalPos, uint8_t l
             bIsAlly = true;
         }
 
-        Position current_pos = pObj->GetCurrentPosition(sWorld.GetArTime());
-        if (!pTester->IsInRegion(current_pos))
-            continue;
-
-        if (!bIncludeOriginalPos && OriginalPos == current_pos)
+        if (!bIncludeOriginalPos && OriginalPos == pObj->GetCurrentPosition(t))
             continue;
 
         if (bIsAlly) {
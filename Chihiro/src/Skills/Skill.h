@@ -20,6 +20,7 @@
 #include "Unit.h"
 #include "SkillBase.h"
 
+class BatchStatement;
 class XPacket;
 
 enum SkillStatus : int { SS_IDLE = 0, SS_CAST = 1, SS_FIRE = 2, SS_COMPLETE = 3, SS_PRE_CAST = 4 };
@@ -42,7 +43,7 @@ public:
     Skill() = delete;
     Skill(Unit *pOwner, int64_t _uid, int32_t _id);
     // Replace statement - acts as insert and update
-    static void DB_InsertSkill(Unit *pUnit, int64_t skillUID, int32_t skill_id, int32_t skill_level, int32_t cool_time);
+    static void DB_InsertSkill(Unit *pUnit, int64_t skillUID, int32_t skill_id, int32_t skill_level, int32_t cool_time, BatchStatement *pBatch = nullptr);
     // skills
     static void AddSkillResult(std::vector<SkillResult> &pvList, bool bIsSuccess, int32_t nSuccessType, uint32_t handle);
     static void AddSkillDamageResult(std::vector<SkillResult> &pvList, uint8_t type, int32_t damageType, DamageInfo damageInfo, uint32_t handle);
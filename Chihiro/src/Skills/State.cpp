@@ -195,7 +195,7 @@ void State::init(int32_t uid, int32_t code)
     m_nUID = (uint16_t)uid;
 }
 
-void State::DB_InsertState(Unit *pOwner, State *pState)
+void State::DB_InsertState(Unit *pOwner, State *pState, BatchStatement *pBatch)
 {
     if (pState->m_bAura)
         return;
@@ -231,7 +231,10 @@ void State::DB_InsertState(Unit *pOwner, State *pState)
     stmt->setInt32(17, pState->m_nStateValue);
     stmt->setString(18, pState->m_szStateValue);
     stmt->setInt32(19, 0);
-    CharacterDatabase.Execute(stmt);
+    if (pBatch != nullptr)
+        pBatch->Append(stmt);
+    else
+        CharacterDatabase.Execute(stmt);
 }
 
 void State::DB_ClearState(Unit *pOwner)
@@ -46,11 +46,12 @@ struct StateDamage {
     uint16_t uid;
 };
 
+class BatchStatement;
 class Unit;
 class State : public Object {
 public:
     static void DB_ClearState(Unit *pOwner);
-    static void DB_InsertState(Unit *pOwner, State *pState);
+    static void DB_InsertState(Unit *pOwner, State *pState, BatchStatement *pBatch = nullptr);
 
     State() = default;
     ~State() = default;
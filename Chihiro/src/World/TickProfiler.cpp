@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickProfiler.h"
+
+#include <algorithm>
+
+#include "Config.h"
+#include "Log.h"
+#include "Timer.h"
+
+constexpr char const *SubTypeName[TickProfiler::SUBTYPE_COUNT] = {"player", "npc", "object", "monster", "summon", "skill_prop", "field_prop", "pet", "state"};
+
+void TickProfiler::InitializeTickProfiler()
+{
+    m_nBudget = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("World.TickBudget", 100), 0));
+    if (IsEnabled())
+        NG_LOG_INFO("server.worldserver", "Tick profiler enabled, ticks above %u ms will be logged.", m_nBudget);
+}
+
+void TickProfiler::BeginTick()
+{
+    if (!IsEnabled())
+        return;
+
+    m_CurrentTick = TickRecord{};
+    m_CurrentTick.nStartTime = getMSTime();
+    m_nSlowestCount = 0;
+    m_tTickStart = std::chrono::steady_clock::now();
+}
+
+void TickProfiler::EndTick()
+{
+    if (!IsEnabled())
+        return;
+
+    m_CurrentTick.nTotal = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_tTickStart).count());
+
+    m_vHistory[m_nHistoryHead] = m_CurrentTick;
+    m_nHistoryHead = (m_nHistoryHead + 1) % HISTORY_SIZE;
+    m_nHistoryCount = std::min(m_nHistoryCount + 1, HISTORY_SIZE);
+
+    if (m_CurrentTick.nTotal >= m_nBudget * 1000)
+        dumpTick();
+}
+
+void TickProfiler::AddEntity(uint32_t nHandle, uint8_t nSubType, uint32_t nMicroseconds)
+{
+    if (nSubType < SUBTYPE_COUNT) {
+        m_CurrentTick.vSubTypeTime[nSubType] += nMicroseconds;
+        ++m_CurrentTick.vSubTypeCount[nSubType];
+    }
+
+    // Keep the slowest few, replacing the fastest of them once the list is full
+    if (m_nSlowestCount < SLOWEST_ENTITY_COUNT) {
+        m_vSlowest[m_nSlowestCount++] = EntitySample{nHandle, nSubType, nMicroseconds};
+        return;
+    }
+    auto *pFastest = &m_vSlowest[0];
+    for (auto &sample : m_vSlowest) {
+        if (sample.nTime < pFastest->nTime)
+            pFastest = &sample;
+    }
+    if (nMicroseconds > pFastest->nTime)
+        *pFastest = EntitySample{nHandle, nSubType, nMicroseconds};
+}
+
+const TickProfiler::TickRecord *TickProfiler::GetTick(int32_t nAgo) const
+{
+    if (nAgo < 0 || nAgo >= m_nHistoryCount)
+        return nullptr;
+    return &m_vHistory[(m_nHistoryHead - 1 - nAgo + HISTORY_SIZE) % HISTORY_SIZE];
+}
+
+void TickProfiler::dumpTick() const
+{
+    uint64_t nHistoryTotal = 0;
+    for (int32_t i = 0; i < m_nHistoryCount; ++i)
+        nHistoryTotal += m_vHistory[i].nTotal;
+
+    NG_LOG_WARN("server.worldserver", "Slow tick: %u us (budget %u ms, average of the last %d ticks %u us)", m_CurrentTick.nTotal, m_nBudget, m_nHistoryCount,
+        static_cast<uint32_t>(nHistoryTotal / m_nHistoryCount));
+
+    uint32_t nPhaseTotal = 0;
+    for (int32_t i = 0; i < TP_MAX; ++i) {
+        nPhaseTotal += m_CurrentTick.vPhase[i];
+        if (m_CurrentTick.vPhase[i] != 0)
+            NG_LOG_WARN("server.worldserver", "  phase %-15s %8u us", TickPhaseName[i], m_CurrentTick.vPhase[i]);
+    }
+    if (m_CurrentTick.nTotal > nPhaseTotal)
+        NG_LOG_WARN("server.worldserver", "  phase %-15s %8u us", "untracked", m_CurrentTick.nTotal - nPhaseTotal);
+
+    for (int32_t i = 0; i < SUBTYPE_COUNT; ++i) {
+        if (m_CurrentTick.vSubTypeCount[i] != 0)
+            NG_LOG_WARN("server.worldserver", "  type  %-15s %8u us in %u updates", SubTypeName[i], m_CurrentTick.vSubTypeTime[i], m_CurrentTick.vSubTypeCount[i]);
+    }
+
+    auto vSlowest = m_vSlowest;
+    std::sort(vSlowest.begin(), vSlowest.begin() + m_nSlowestCount, [](const EntitySample &lhs, const EntitySample &rhs) { return lhs.nTime > rhs.nTime; });
+    for (int32_t i = 0; i < m_nSlowestCount; ++i) {
+        NG_LOG_WARN("server.worldserver", "  slow  %-10s 0x%08X %8u us", vSlowest[i].nSubType < SUBTYPE_COUNT ? SubTypeName[vSlowest[i].nSubType] : "unknown",
+            vSlowest[i].nHandle, vSlowest[i].nTime);
+    }
+}
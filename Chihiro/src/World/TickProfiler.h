@@ -0,0 +1,129 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <array>
+#include <chrono>
+
+#include "Define.h"
+
+enum TickPhase : int32_t {
+    TP_SESSIONS = 0,
+    TP_OBJECTS,
+    TP_OBJECT_REMOVAL,
+    TP_FIELD_PROPS,
+    TP_ITEM_COLLECTOR,
+    TP_RESPAWN,
+    TP_TIMERS,
+    TP_INTEREST,
+    TP_UNIT_UPDATES,
+    TP_MAX
+};
+
+constexpr char const *TickPhaseName[TP_MAX] = {"sessions", "objects", "object_removal", "field_props", "item_collector", "respawn", "timers", "interest", "unit_updates"};
+
+/// \brief Breaks every world tick down into phases and object types
+/// Only the world thread touches it, so nothing here is locked.
+/// The last ticks are kept in a ring buffer, a tick above World.TickBudget
+/// logs its phases, the per type totals and the slowest objects.
+class TickProfiler {
+public:
+    static constexpr int32_t HISTORY_SIZE = 256;
+    static constexpr int32_t SLOWEST_ENTITY_COUNT = 8;
+    static constexpr int32_t SUBTYPE_COUNT = 9; // ST_Player .. ST_State
+
+    struct EntitySample {
+        uint32_t nHandle;
+        uint8_t nSubType;
+        uint32_t nTime;
+    };
+
+    struct TickRecord {
+        uint32_t nStartTime;
+        uint32_t nTotal; // all durations in microseconds
+        std::array<uint32_t, TP_MAX> vPhase;
+        std::array<uint32_t, SUBTYPE_COUNT> vSubTypeTime;
+        std::array<uint32_t, SUBTYPE_COUNT> vSubTypeCount;
+    };
+
+    static TickProfiler &Instance()
+    {
+        static TickProfiler instance;
+        return instance;
+    }
+
+    ~TickProfiler() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    TickProfiler(const TickProfiler &) = delete;
+    TickProfiler &operator=(const TickProfiler &) = delete;
+
+    /// \brief Reads World.TickBudget, 0 disables the profiler
+    void InitializeTickProfiler();
+    bool IsEnabled() const { return m_nBudget != 0; }
+
+    void BeginTick();
+    void EndTick();
+
+    void AddPhase(TickPhase ePhase, uint32_t nMicroseconds) { m_CurrentTick.vPhase[ePhase] += nMicroseconds; }
+    void AddEntity(uint32_t nHandle, uint8_t nSubType, uint32_t nMicroseconds);
+
+    /// \return the tick that ended nAgo ticks ago, nullptr if it is not in the history
+    const TickRecord *GetTick(int32_t nAgo) const;
+
+private:
+    TickProfiler() = default;
+
+    void dumpTick() const;
+
+    uint32_t m_nBudget{0};
+    std::chrono::steady_clock::time_point m_tTickStart{};
+    TickRecord m_CurrentTick{};
+    std::array<EntitySample, SLOWEST_ENTITY_COUNT> m_vSlowest{};
+    int32_t m_nSlowestCount{0};
+
+    std::array<TickRecord, HISTORY_SIZE> m_vHistory{};
+    int32_t m_nHistoryHead{0};
+    int32_t m_nHistoryCount{0};
+};
+
+#define sTickProfiler TickProfiler::Instance()
+
+/// Adds the lifetime of the scope to a phase of the current tick
+class TickZone {
+public:
+    explicit TickZone(TickPhase ePhase)
+        : m_ePhase(ePhase)
+        , m_bEnabled(sTickProfiler.IsEnabled())
+    {
+        if (m_bEnabled)
+            m_tStart = std::chrono::steady_clock::now();
+    }
+
+    ~TickZone()
+    {
+        if (m_bEnabled)
+            sTickProfiler.AddPhase(m_ePhase, static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_tStart).count()));
+    }
+
+    TickZone(const TickZone &) = delete;
+    TickZone &operator=(const TickZone &) = delete;
+
+private:
+    TickPhase m_ePhase;
+    bool m_bEnabled;
+    std::chrono::steady_clock::time_point m_tStart{};
+};
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickScheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Config.h"
+#include "Log.h"
+#include "Metrics.h"
+
+// Weight of the newest tick in the moving average, ~20 ticks (one second) to react
+constexpr float BUSY_SMOOTHING = 0.05f;
+// Entering a level needs the upper bound, leaving it the lower one, so the level does not flap
+constexpr float LOAD_HIGH_ENTER = 0.8f;
+constexpr float LOAD_HIGH_LEAVE = 0.6f;
+constexpr float LOAD_CRITICAL_ENTER = 1.0f;
+constexpr float LOAD_CRITICAL_LEAVE = 0.85f;
+
+constexpr char const *TickLoadName[] = {"normal", "high", "critical"};
+
+void TickScheduler::InitializeTickScheduler()
+{
+    m_tInterval = std::chrono::milliseconds(std::max(sConfigMgr->GetIntDefault("World.TickInterval", 50), 1));
+    m_nMaxCatchUp = std::max(sConfigMgr->GetIntDefault("World.MaxCatchUpTicks", 4), 0);
+    m_bShedding = sConfigMgr->GetBoolDefault("World.LoadShedding", true);
+
+    m_pOverrun = &sMetrics.GetCounter("world.tick_overrun");
+    m_pDropped = &sMetrics.GetCounter("world.tick_dropped");
+    m_pDrift = &sMetrics.GetGauge("world.tick_drift_us");
+    m_pLoad = &sMetrics.GetGauge("world.load_level");
+}
+
+uint32_t TickScheduler::BeginTick()
+{
+    m_tTickStart = std::chrono::steady_clock::now();
+    if (m_nTickCount == 0) {
+        m_tLastTick = m_tTickStart;
+        m_tDeadline = m_tTickStart + m_tInterval;
+    }
+    m_pDrift->Set(std::chrono::duration_cast<std::chrono::microseconds>(m_tTickStart - (m_tDeadline - m_tInterval)).count());
+    ++m_nTickCount;
+
+    // Whole milliseconds only, the remainder is carried over into the next tick
+    auto tElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(m_tTickStart - m_tLastTick);
+    m_tLastTick += tElapsed;
+    return static_cast<uint32_t>(tElapsed.count());
+}
+
+void TickScheduler::EndTick()
+{
+    auto tNow = std::chrono::steady_clock::now();
+    auto tBusy = tNow - m_tTickStart;
+    if (tBusy >= m_tInterval)
+        m_pOverrun->Add();
+    updateLoad(std::chrono::duration<float>(tBusy) / std::chrono::duration<float>(m_tInterval));
+
+    if (tNow > m_tDeadline + m_nMaxCatchUp * m_tInterval) {
+        // Too far behind to catch up, start over from now
+        auto nMissed = (tNow - m_tDeadline) / m_tInterval;
+        m_pDropped->Add(static_cast<uint64_t>(nMissed));
+        m_tDeadline = tNow + m_tInterval;
+        return;
+    }
+
+    if (tNow < m_tDeadline)
+        std::this_thread::sleep_until(m_tDeadline);
+    m_tDeadline += m_tInterval;
+}
+
+void TickScheduler::updateLoad(float fBusy)
+{
+    m_fBusy += (fBusy - m_fBusy) * BUSY_SMOOTHING;
+    if (!m_bShedding)
+        return;
+
+    TickLoad eLoad = m_eLoad;
+    switch (m_eLoad) {
+    case TICK_LOAD_NORMAL:
+        if (m_fBusy >= LOAD_HIGH_ENTER)
+            eLoad = TICK_LOAD_HIGH;
+        break;
+    case TICK_LOAD_HIGH:
+        if (m_fBusy >= LOAD_CRITICAL_ENTER)
+            eLoad = TICK_LOAD_CRITICAL;
+        else if (m_fBusy < LOAD_HIGH_LEAVE)
+            eLoad = TICK_LOAD_NORMAL;
+        break;
+    case TICK_LOAD_CRITICAL:
+        if (m_fBusy < LOAD_CRITICAL_LEAVE)
+            eLoad = TICK_LOAD_HIGH;
+        break;
+    }
+
+    if (eLoad == m_eLoad)
+        return;
+
+    NG_LOG_WARN("server.worldserver", "World load changed from %s to %s (%d%% of the tick interval in use).", TickLoadName[m_eLoad], TickLoadName[eLoad],
+        static_cast<int32_t>(m_fBusy * 100));
+    m_eLoad = eLoad;
+    m_nStride = 1u << static_cast<uint32_t>(m_eLoad);
+    m_pLoad->Set(m_eLoad);
+}
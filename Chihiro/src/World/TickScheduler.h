@@ -0,0 +1,89 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+
+#include "Define.h"
+
+namespace NGemity::Metrics {
+    class Counter;
+    class Gauge;
+} // namespace NGemity::Metrics
+
+enum TickLoad : int32_t { TICK_LOAD_NORMAL = 0, TICK_LOAD_HIGH, TICK_LOAD_CRITICAL };
+
+/// \brief Paces the world thread at a fixed rate
+/// Ticks are scheduled against absolute deadlines on the monotonic clock, so a
+/// slow tick is caught up by the following ones instead of shifting every later tick.
+/// Once the world is more than World.MaxCatchUpTicks behind, the missed ticks are dropped.
+///
+/// The share of the interval spent updating is averaged over the last ticks. When it
+/// stays high the load level goes up and non critical work (idle monsters, respawns,
+/// item expiry) only runs every second or fourth tick, see IsDeferred.
+class TickScheduler {
+public:
+    static TickScheduler &Instance()
+    {
+        static TickScheduler instance;
+        return instance;
+    }
+
+    ~TickScheduler() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    TickScheduler(const TickScheduler &) = delete;
+    TickScheduler &operator=(const TickScheduler &) = delete;
+
+    void InitializeTickScheduler();
+
+    /// \return milliseconds since the last tick began
+    uint32_t BeginTick();
+    /// \brief Accounts the tick and sleeps until the next one is due
+    void EndTick();
+
+    TickLoad GetLoad() const { return m_eLoad; }
+    uint32_t GetTickCount() const { return m_nTickCount; }
+
+    /// \brief Tells low priority work whether to skip this tick
+    /// Work keyed differently is spread over different ticks, everything runs every tick under normal load.
+    bool IsDeferred(uint32_t nKey) const { return m_nStride > 1 && (nKey + m_nTickCount) % m_nStride != 0; }
+
+private:
+    TickScheduler() = default;
+
+    void updateLoad(float fBusy);
+
+    std::chrono::milliseconds m_tInterval{50};
+    int32_t m_nMaxCatchUp{4};
+    bool m_bShedding{true};
+
+    std::chrono::steady_clock::time_point m_tDeadline{};
+    std::chrono::steady_clock::time_point m_tLastTick{};
+    std::chrono::steady_clock::time_point m_tTickStart{};
+    uint32_t m_nTickCount{0};
+
+    float m_fBusy{0.0f}; // moving average of update time / interval
+    TickLoad m_eLoad{TICK_LOAD_NORMAL};
+    uint32_t m_nStride{1};
+
+    NGemity::Metrics::Counter *m_pOverrun{nullptr};
+    NGemity::Metrics::Counter *m_pDropped{nullptr};
+    NGemity::Metrics::Gauge *m_pDrift{nullptr};
+    NGemity::Metrics::Gauge *m_pLoad{nullptr};
+};
+
+#define sTickScheduler TickScheduler::Instance()
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UnitUpdateAggregator.h"
+
+#include "Config.h"
+#include "MemPool.h"
+#include "Messages.h"
+#include "Metrics.h"
+#include "Unit.h"
+#include "World.h"
+
+void UnitUpdateAggregator::InitializeUnitUpdateAggregator()
+{
+    m_bEnabled = sConfigMgr->GetBoolDefault("World.CoalesceUnitUpdates", true);
+    m_pCoalesced = &sMetrics.GetCounter("world.unit_updates_coalesced");
+}
+
+bool UnitUpdateAggregator::AddHPMP(Unit *pUnit, int32_t nAddHP, float fAddMP, bool bDisplay)
+{
+    if (!m_bEnabled || pUnit == nullptr)
+        return false;
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto &update = getPending(pUnit->GetHandle());
+    if (update.bHPMP)
+        m_pCoalesced->Add();
+    update.bHPMP = true;
+    update.nAddHP += nAddHP;
+    update.fAddMP += fAddMP;
+    if (bDisplay) {
+        update.bDisplay = true;
+        update.nDisplayHP += nAddHP;
+        update.fDisplayMP += fAddMP;
+    }
+    return true;
+}
+
+bool UnitUpdateAggregator::AddStatus(WorldObject *pObject)
+{
+    if (!m_bEnabled || pObject == nullptr)
+        return false;
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto &update = getPending(pObject->GetHandle());
+    if (update.bStatus)
+        m_pCoalesced->Add();
+    update.bStatus = true;
+    return true;
+}
+
+bool UnitUpdateAggregator::AddState(Unit *pUnit, const TS_SC_STATE &statePct)
+{
+    if (!m_bEnabled || pUnit == nullptr)
+        return false;
+
+    NG_UNIQUE_GUARD writeGuard(i_lock);
+    auto &update = getPending(pUnit->GetHandle());
+    for (auto &pending : update.vStates) {
+        if (pending.state_handle == statePct.state_handle) {
+            pending = statePct;
+            m_pCoalesced->Add();
+            return true;
+        }
+    }
+    update.vStates.emplace_back(statePct);
+    return true;
+}
+
+void UnitUpdateAggregator::Flush()
+{
+    std::vector<PendingUpdate> vPending{};
+    {
+        NG_UNIQUE_GUARD writeGuard(i_lock);
+        vPending.swap(m_vPending);
+        m_mIndex.clear();
+    }
+
+    // Broadcasting takes the region locks, so nothing is held here
+    for (auto &update : vPending)
+        flushUpdate(update);
+}
+
+UnitUpdateAggregator::PendingUpdate &UnitUpdateAggregator::getPending(uint32_t nHandle)
+{
+    auto it = m_mIndex.find(nHandle);
+    if (it != m_mIndex.end())
+        return m_vPending[it->second];
+
+    m_mIndex.emplace(nHandle, m_vPending.size());
+    auto &update = m_vPending.emplace_back();
+    update.nHandle = nHandle;
+    return update;
+}
+
+void UnitUpdateAggregator::flushUpdate(PendingUpdate &update)
+{
+    // Whatever left the world during the tick has been removed from the clients already
+    auto pObject = sMemoryPool.GetObjectInWorld<WorldObject>(update.nHandle);
+    if (pObject == nullptr || !pObject->IsInWorld())
+        return;
+
+    auto pUnit = pObject->IsUnit() ? pObject->As<Unit>() : nullptr;
+    if (pUnit != nullptr) {
+        for (auto &statePct : update.vStates)
+            sWorld.Broadcast(pUnit->GetRX(), pUnit->GetRY(), pUnit->GetLayer(), statePct);
+
+        if (update.bHPMP) {
+            if (update.bDisplay)
+                Messages::BroadcastHPMPMessageNow(pUnit, update.nDisplayHP, update.fDisplayMP, true);
+            else
+                Messages::BroadcastHPMPMessageNow(pUnit, update.nAddHP, update.fAddMP, false);
+        }
+    }
+
+    if (update.bStatus)
+        Messages::BroadcastStatusMessageNow(pObject);
+}
@@ -0,0 +1,92 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+// ClientPackets.h needs the fixed width types from above
+#include "ClientPackets.h"
+#include "SharedMutex.h"
+
+class Unit;
+class WorldObject;
+
+namespace NGemity::Metrics {
+    class Counter;
+} // namespace NGemity::Metrics
+
+/// \brief Collects HP/MP, status and state changes of units during a world tick
+/// Every unit gets at most one TS_SC_HPMP, one TS_SC_STATUS_CHANGE and one TS_SC_STATE
+/// per state broadcast per tick, sent by Flush at the end of World::Update.
+///
+/// HP/MP and status are read when flushing, so the last value wins. The add_hp and add_mp
+/// deltas are summed; once any change of the tick asked to be displayed, only the displayed
+/// ones are summed, so damage already shown by an attack packet is not shown again.
+/// Changes are queued from the network threads as well, everything is locked.
+class UnitUpdateAggregator {
+public:
+    static UnitUpdateAggregator &Instance()
+    {
+        static UnitUpdateAggregator instance;
+        return instance;
+    }
+
+    ~UnitUpdateAggregator() = default;
+    // Deleting the copy & assignment operators
+    // Better safe than sorry
+    UnitUpdateAggregator(const UnitUpdateAggregator &) = delete;
+    UnitUpdateAggregator &operator=(const UnitUpdateAggregator &) = delete;
+
+    void InitializeUnitUpdateAggregator();
+
+    /// \return false if coalescing is disabled and the caller has to broadcast right away
+    bool AddHPMP(Unit *pUnit, int32_t nAddHP, float fAddMP, bool bDisplay);
+    bool AddStatus(WorldObject *pObject);
+    bool AddState(Unit *pUnit, const TS_SC_STATE &statePct);
+
+    /// \brief Broadcasts everything collected since the last flush
+    void Flush();
+
+private:
+    UnitUpdateAggregator() = default;
+
+    struct PendingUpdate {
+        uint32_t nHandle{0};
+        bool bHPMP{false};
+        bool bStatus{false};
+        bool bDisplay{false};
+        int32_t nAddHP{0};
+        float fAddMP{0};
+        int32_t nDisplayHP{0};
+        float fDisplayMP{0};
+        std::vector<TS_SC_STATE> vStates{};
+    };
+
+    PendingUpdate &getPending(uint32_t nHandle);
+    void flushUpdate(PendingUpdate &update);
+
+    bool m_bEnabled{true};
+
+    NG_SHARED_MUTEX i_lock;
+    std::vector<PendingUpdate> m_vPending{};              // in the order the units got dirty
+    std::unordered_map<uint32_t, std::size_t> m_mIndex{}; // handle -> m_vPending
+
+    NGemity::Metrics::Counter *m_pCoalesced{nullptr};
+};
+
+#define sUnitUpdateAggregator UnitUpdateAggregator::Instance()
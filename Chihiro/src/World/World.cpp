@@ -20,11 +20,14 @@
 #include "ClientPackets.h"
 #include "Config.h"
 #include "DatabaseEnv.h"
+#include "EnterPacketEncoder.h"
 #include "FieldPropManager.h"
 #include "GameContent.h"
 #include "GameRule.h"
 #include "GroupManager.h"
+#include "InterestManager.h"
 #include "ItemCollector.h"
+#include "LineOfSight.h"
 #include "Log.h"
 #include "Maploader.h"
 #include "MemPool.h"
@@ -33,8 +36,13 @@
 #include "ObjectMgr.h"
 #include "Packets/PacketEpics.h"
 #include "Player.h"
+#include "RegionSleep.h"
 #include "Scripting/XLua.h"
 #include "Skill.h"
+#include "SpawnPointCache.h"
+#include "TickProfiler.h"
+#include "TickScheduler.h"
+#include "UnitUpdateAggregator.h"
 #include "WorldSession.h"
 
 std::atomic<bool> World::m_stopEvent{false};
@@ -80,6 +88,7 @@ void World::InitWorld()
     oldTime = getMSTime();
     NG_LOG_INFO("server.worldserver", "Initializing scripting...");
     sScriptingMgr.InitializeLua();
+    sScriptingMgr.PrecompileContentScripts();
     sMapContent.LoadMapContent();
     sMapContent.InitMapInfo();
     NG_LOG_INFO("server.worldserver", "Initialized scripting in %u ms", GetMSTimeDiffToNow(oldTime));
@@ -91,6 +100,7 @@ void World::InitWorld()
         auto ro = new RespawnObject{nri};
         m_vRespawnList.emplace_back(ro);
     }
+    sSpawnPointCache.Initialize("Resource/NewMap/spawnpoint.cache");
     GameContent::AddNPCToWorld();
 
     NG_LOG_INFO("server.worldserver", "World fully initialized in %u ms!", GetMSTimeDiffToNow(oldFullTime));
@@ -331,6 +341,10 @@ void World::RemoveObjectFromWorld(WorldObject *obj)
     TS_SC_LEAVE leavePct{};
     leavePct.handle = obj->GetHandle();
 
+    // A sleeping monster has to be back in the update list to get deleted
+    if (obj->IsMonster())
+        sRegionSleep.Wake(obj->As<Monster>());
+
     BroadcastFunctor<TS_SC_LEAVE> broadcastFunctor;
     broadcastFunctor.packet = leavePct;
 
@@ -340,6 +354,8 @@ void World::RemoveObjectFromWorld(WorldObject *obj)
     // Send one to each player in visible region
     sRegion.DoEachVisibleRegion((uint32_t)(obj->GetPositionX() / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)), (uint32_t)(obj->GetPositionY() / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)),
         obj->GetLayer(), NG_REGION_FUNCTOR(broadcastFunctor), (uint8_t)RegionVisitor::ClientVisitor);
+    sInterestManager.Forget(obj);
+    sEnterPacketEncoder.Forget(obj);
 }
 
 void World::step(WorldObject *obj, uint32_t tm)
@@ -360,23 +376,50 @@ bool World::onSetMove(WorldObject *pObject, Position curPos, Position lastpos)
 void World::Update(uint32_t diff)
 {
     ///- Update Sessions
-    UpdateSessions(diff);
+    {
+        TickZone zone(TP_SESSIONS);
+        UpdateSessions(diff);
+    }
+
+    sRegionSleep.Update();
 
     ///- Update for WorldObjects (Player, Monster, ...)
     sMemoryPool.Update(diff);
 
     ///- Temporary hack for respawn list
     ///- @todo Rewrite (re)spawning
-    for (auto &ro : m_vRespawnList) {
-        ro->Update(diff);
-        // m_vRespawnList.erase(std::remove(m_vRespawnList.begin(), m_vRespawnList.end(), ro), m_vRespawnList.end());
+    {
+        TickZone zone(TP_RESPAWN);
+        // Respawns are due on their own timers, under load each one is checked on fewer ticks
+        for (uint32_t i = 0; i < m_vRespawnList.size(); ++i) {
+            if (sTickScheduler.IsDeferred(i))
+                continue;
+            auto &ro = m_vRespawnList[i];
+            ro->Update(diff);
+            // m_vRespawnList.erase(std::remove(m_vRespawnList.begin(), m_vRespawnList.end(), ro), m_vRespawnList.end());
+        }
     }
 
-    for (auto &timer : m_timers) {
-        if (timer.GetCurrent() >= 0)
-            timer.Update(diff);
-        else
-            timer.SetCurrent(0);
+    {
+        TickZone zone(TP_TIMERS);
+        for (auto &timer : m_timers) {
+            if (timer.GetCurrent() >= 0)
+                timer.Update(diff);
+            else
+                timer.SetCurrent(0);
+        }
+    }
+
+    {
+        TickZone zone(TP_INTEREST);
+        sInterestManager.Update();
+    }
+
+    sLineOfSight.Update();
+
+    {
+        TickZone zone(TP_UNIT_UPDATES);
+        sUnitUpdateAggregator.Flush();
     }
 
     /*
@@ -541,9 +584,9 @@ void World::MonsterDropItemToWorld(Unit *pUnit, Item *pItem)
 
 void World::AddItemToWorld(Item *pItem)
 {
+    pItem->m_nDropTime = GetArTime();
     sItemCollector.RegisterItem(pItem);
     AddObjectToWorld(pItem);
-    pItem->m_nDropTime = GetArTime();
 }
 
 bool World::RemoveItemFromWorld(Item *pItem)
@@ -763,7 +806,7 @@ void World::addEXP(Unit *pCorpse, int32_t nPartyID, int32_t exp, float jp)
     sGroupManager.DoEachMemberTag(nPartyID, [&pCorpse, &nMinLevel, &nMaxLevel, &nTotalLevel, &nCount, &nTotalCount, &pOneManPlayer](PartyMemberTag &tag) {
         if (tag.bIsOnline && tag.pPlayer != nullptr) {
             nTotalCount++;
-            if (tag.pPlayer->IsInWorld() && pCorpse->GetLayer() == tag.pPlayer->GetLayer() && pCorpse->GetExactDist2d(tag.pPlayer) <= 500.0f) {
+            if (tag.pPlayer->IsInWorld() && pCorpse->GetLayer() == tag.pPlayer->GetLayer() && pCorpse->GetExactDist2dSq(tag.pPlayer) <= 500.0f * 500.0f) {
                 pOneManPlayer = tag.pPlayer;
                 int32_t l = tag.pPlayer->GetLevel();
                 if (nMaxLevel < l)
@@ -837,8 +880,11 @@ void World::procPartyShare(Player *pClient, Item *pItem)
 
 void World::EnumMovableObject(Position pos, uint8_t layer, float range, std::vector<uint32_t> &pvResult, bool bIncludeClient, bool bIncludeNPC)
 {
-    EnumMovableObjectRegionFunctor fn(pvResult, pos, range, bIncludeClient, bIncludeNPC);
-    sRegion.DoEachVisibleRegion((uint32_t)(pos.GetPositionX() / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)), (uint32_t)(pos.GetPositionY() / sWorld.getIntConfig(CONFIG_MAP_REGION_SIZE)), layer, fn);
+    std::vector<RangeCandidate> vCandidates{};
+    EnumMovableObject(RangeCircle{pos.GetPositionX(), pos.GetPositionY(), range}, layer, vCandidates, bIncludeClient, bIncludeNPC);
+    pvResult.reserve(pvResult.size() + vCandidates.size());
+    for (const auto &candidate : vCandidates)
+        pvResult.emplace_back(candidate.handle);
 }
 
 void World::MoveObject(Unit *pObject, Position &newPos, float face)
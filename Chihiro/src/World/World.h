@@ -89,6 +89,20 @@ public:
     bool SetMove(Unit *obj, Position curPos, Position newPos, uint8_t speed, bool bAbsoluteMove, uint32_t t, bool bBroadcastMove = true);
     void MoveObject(Unit *pObject, Position &newPos, float face);
     void EnumMovableObject(Position pos, uint8_t layer, float range, std::vector<uint32_t> &pvResult, bool bIncludeClient = true, bool bIncludeNPC = true);
+    /// \brief Players and movable objects inside shape (RangeCircle, RangeRect, RangeArc) with their current position
+    template<typename Shape>
+    void EnumMovableObject(const Shape &shape, uint8_t layer, std::vector<RangeCandidate> &vResult, bool bIncludeClient = true, bool bIncludeNPC = true)
+    {
+        uint8_t nBitset = (bIncludeClient ? (uint8_t)RegionVisitor::ClientVisitor : 0) | (bIncludeNPC ? (uint8_t)RegionVisitor::MovableVisitor : 0);
+        sRegion.EnumObjectsInRange(shape, layer, nBitset, GetArTime(), vResult);
+    }
+    /// \brief Calls fn(const RangeCandidate &) for the players and movable objects inside shape, no region is locked while fn runs
+    template<typename Shape, typename Fn>
+    void DoEachMovableObject(const Shape &shape, uint8_t layer, Fn &&fn, bool bIncludeClient = true, bool bIncludeNPC = true)
+    {
+        uint8_t nBitset = (bIncludeClient ? (uint8_t)RegionVisitor::ClientVisitor : 0) | (bIncludeNPC ? (uint8_t)RegionVisitor::MovableVisitor : 0);
+        sRegion.DoEachObjectInRange(shape, layer, nBitset, GetArTime(), std::forward<Fn>(fn));
+    }
 
     void addEXP(Unit *pCorpse, Player *pPlayer, int32_t exp, float jp);
     void addEXP(Unit *pCorpse, int32_t nPartyID, int32_t exp, float jp);
@@ -17,162 +17,175 @@
 
 #include "QuadTreeMapInfo.h"
 
-X2D::QuadTreeMapInfo::Node::Node(X2D::Pointf p1, X2D::Pointf p2, uint16_t depth)
-{
-    this->m_Area = RectangleF(p1, p2);
-    m_unDepth = depth;
-}
+#include <algorithm>
+#include <numeric>
 
-bool X2D::QuadTreeMapInfo::Node::Add(MapLocationInfo u)
+constexpr uint32_t QUADTREE_NODE_ITEMS = 8;
+constexpr uint16_t QUADTREE_MAX_DEPTH = 10;
+
+X2D::QuadTreeMapInfo::QuadTreeMapInfo(float width, float height)
 {
-    bool result;
-    Node nn{};
-    nn.init = false;
-
-    result = u.IsCollision(this->m_Area);
-    if (result) {
-        if (this->m_pNode.count(0) != 0)
-            nn = this->getFitNode(u);
-        if (this->m_pNode.count(0) == 0 || !nn.init || !nn.Add(u))
-            this->add(u);
-        result = true;
-    }
-    return result;
+    Pointf p1 = Pointf(0, 0);
+    Pointf p2 = Pointf(width, height);
+    m_Area = RectangleF(p1, p2);
 }
 
-void X2D::QuadTreeMapInfo::Node::Enum(X2D::Pointf c, X2D::QuadTreeMapInfo::FunctorAdaptor &f)
+void X2D::QuadTreeMapInfo::Enum(X2D::Pointf c, X2D::QuadTreeMapInfo::FunctorAdaptor &f)
 {
-    if (this->m_Area.IsInclude(c.x, c.y)) {
-        if (this->m_pNode.count(0) != 0) {
-            this->m_pNode[0].Enum(c, f);
-            this->m_pNode[1].Enum(c, f);
-            this->m_pNode[2].Enum(c, f);
-            this->m_pNode[3].Enum(c, f);
-        }
-
-        for (auto &info : m_vList) {
-            if (info.IsInclude(c)) {
-                f.pResult.push_back(info);
-            }
-        }
-    }
+    if (!m_Area.IsInclude(c.x, c.y))
+        return;
+
+    std::vector<uint32_t> vFound{};
+    query([&c](float l, float t, float r, float b) { return c.x >= l && c.x <= r && c.y >= t && c.y <= b; },
+        [this, &c, &vFound](uint32_t nPolygon) {
+            if (m_vPolygons[nPolygon].IsInclude(c))
+                vFound.emplace_back(nPolygon);
+            return false;
+        });
+
+    // Callers pick by priority and keep the first of equal ones
+    std::sort(vFound.begin(), vFound.end());
+    for (auto nPolygon : vFound)
+        f.pResult.push_back(m_vPolygons[nPolygon]);
 }
 
-bool X2D::QuadTreeMapInfo::Node::Collision(X2D::Pointf c)
+bool X2D::QuadTreeMapInfo::Add(MapLocationInfo u)
 {
-    if (this->m_Area.IsInclude(c)) {
-        for (auto &p : this->m_vList) {
-            if (p.IsInclude(c))
-                return true;
-        }
+    if (!u.IsCollision(m_Area))
+        return false;
 
-        if (this->m_pNode.count(0) != 0 && (this->m_pNode[0].Collision(c) || this->m_pNode[1].Collision(c) || this->m_pNode[2].Collision(c) || this->m_pNode[3].Collision(c)))
-            return true;
-    }
-    return false;
+    m_vPolygons.emplace_back(std::move(u));
+    m_vNodes.clear();
+    return true;
 }
 
-bool X2D::QuadTreeMapInfo::Node::LooseCollision(X2D::Linef pLine)
+bool X2D::QuadTreeMapInfo::Collision(X2D::Pointf c)
 {
-    if (this->m_Area.IsCollision(pLine)) {
-        for (auto &p : this->m_vList) {
-            if (p.IsLooseCollision(pLine))
-                return true;
-        }
+    if (!m_Area.IsInclude(c))
+        return false;
 
-        if (this->m_pNode.count(0) != 0 &&
-            (this->m_pNode[0].LooseCollision(pLine) || this->m_pNode[1].LooseCollision(pLine) || this->m_pNode[2].LooseCollision(pLine) || this->m_pNode[3].LooseCollision(pLine)))
-            return true;
-    }
-    return false;
+    return query([&c](float l, float t, float r, float b) { return c.x >= l && c.x <= r && c.y >= t && c.y <= b; },
+        [this, &c](uint32_t nPolygon) { return m_vPolygons[nPolygon].IsInclude(c); });
 }
 
-X2D::QuadTreeMapInfo::Node X2D::QuadTreeMapInfo::Node::getFitNode(MapLocationInfo u)
+bool X2D::QuadTreeMapInfo::LooseCollision(X2D::Linef pLine)
 {
-    if (u.IsIn(this->m_pNode[0].m_Area))
-        return this->m_pNode[0];
-    if (u.IsIn(this->m_pNode[1].m_Area))
-        return this->m_pNode[1];
-    if (u.IsIn(this->m_pNode[2].m_Area))
-        return this->m_pNode[2];
-    if (u.IsIn(this->m_pNode[3].m_Area))
-        return this->m_pNode[3];
-    Node node{};
-    node.init = false;
-    return node;
+    if (!m_Area.IsCollision(pLine))
+        return false;
+
+    // An edge can only cross the line where the boxes overlap
+    float fLeft = std::min(pLine.begin.x, pLine.end.x);
+    float fTop = std::min(pLine.begin.y, pLine.end.y);
+    float fRight = std::max(pLine.begin.x, pLine.end.x);
+    float fBottom = std::max(pLine.begin.y, pLine.end.y);
+    return query([=](float l, float t, float r, float b) { return fLeft <= r && fRight >= l && fTop <= b && fBottom >= t; },
+        [this, &pLine](uint32_t nPolygon) { return m_vPolygons[nPolygon].IsLooseCollision(pLine); });
 }
 
-void X2D::QuadTreeMapInfo::Node::add(MapLocationInfo u)
+void X2D::QuadTreeMapInfo::Build()
 {
-    this->m_vList.emplace_back(u);
-    if (this->m_vList.size() >= 10) {
-        if (this->m_unDepth < 10)
-            this->divide();
-    }
+    m_vNodes.clear();
+    m_vItemPolygon.clear();
+    m_vItemLeft.clear();
+    m_vItemTop.clear();
+    m_vItemRight.clear();
+    m_vItemBottom.clear();
+    m_vItemPolygon.reserve(m_vPolygons.size());
+    m_vItemLeft.reserve(m_vPolygons.size());
+    m_vItemTop.reserve(m_vPolygons.size());
+    m_vItemRight.reserve(m_vPolygons.size());
+    m_vItemBottom.reserve(m_vPolygons.size());
+
+    std::vector<uint32_t> vItems(m_vPolygons.size());
+    std::iota(vItems.begin(), vItems.end(), 0);
+    m_vNodes.emplace_back(Node{m_Area.m_TopLeft.x, m_Area.m_TopLeft.y, m_Area.m_BottomRight.x, m_Area.m_BottomRight.y, -1, 0, 0});
+    build(0, vItems, 0);
 }
 
-void X2D::QuadTreeMapInfo::Node::divide()
+void X2D::QuadTreeMapInfo::build(uint32_t nNode, std::vector<uint32_t> &vItems, uint16_t depth)
 {
-    if (this->m_pNode.count(0) == 0) {
-        Pointf p1{};
-        Pointf p2{};
-
-        float easx = ((this->m_Area.m_BottomRight.x - this->m_Area.m_TopLeft.x) * 0.5f) + this->m_Area.m_TopLeft.x;
-        float easy = ((this->m_Area.m_BottomRight.y - this->m_Area.m_TopLeft.y) * 0.5f) + this->m_Area.m_TopLeft.y;
-        auto new_depth = (uint16_t)(this->m_unDepth + 1);
-
-        p1 = Pointf(this->m_Area.m_TopLeft.x, this->m_Area.m_TopLeft.y);
-        p2 = Pointf(this->m_Area.m_TopLeft.x + easx, this->m_Area.m_TopLeft.y + easy);
-        this->m_pNode[0] = Node(p1, p2, new_depth);
-
-        p1 = Pointf(this->m_Area.m_TopLeft.x + easx, this->m_Area.m_TopLeft.y);
-        p1 = Pointf(this->m_Area.m_BottomRight.x, this->m_Area.m_TopLeft.y + easy);
-        this->m_pNode[1] = Node(p1, p2, new_depth);
-
-        p1 = Pointf(this->m_Area.m_TopLeft.x, this->m_Area.m_TopLeft.y + easx);
-        p2 = Pointf(this->m_Area.m_TopLeft.x + easx, this->m_Area.m_BottomRight.y);
-        this->m_pNode[2] = Node(p1, p2, new_depth);
-
-        p1 = Pointf(this->m_Area.m_TopLeft.x + easx, this->m_Area.m_TopLeft.y + easx);
-        p2 = Pointf(this->m_Area.m_BottomRight.x, this->m_Area.m_BottomRight.y);
-        this->m_pNode[3] = Node(p1, p2, new_depth);
-
-        std::vector<MapLocationInfo> nl{};
-
-        for (auto &info : this->m_vList) {
-            Node fn = this->getFitNode(info);
-            if (fn.init) {
-                fn.Add(info);
-            }
-            else {
-                nl.emplace_back(info);
+    std::vector<uint32_t> vChildItems[4]{};
+    if (vItems.size() > QUADTREE_NODE_ITEMS && depth < QUADTREE_MAX_DEPTH) {
+        Node node = m_vNodes[nNode];
+        float fMidX = (node.left + node.right) * 0.5f;
+        float fMidY = (node.top + node.bottom) * 0.5f;
+        Node vChildren[4] = {
+            {node.left, node.top, fMidX, fMidY, -1, 0, 0},
+            {fMidX, node.top, node.right, fMidY, -1, 0, 0},
+            {node.left, fMidY, fMidX, node.bottom, -1, 0, 0},
+            {fMidX, fMidY, node.right, node.bottom, -1, 0, 0},
+        };
+
+        // A polygon goes down into the first child holding its whole box, the others stay here
+        std::vector<uint32_t> vKeep{};
+        for (auto nPolygon : vItems) {
+            auto &area = m_vPolygons[nPolygon].m_Area;
+            int32_t nChild = 0;
+            for (; nChild < 4; ++nChild) {
+                auto &child = vChildren[nChild];
+                if (area.m_TopLeft.x >= child.left && area.m_BottomRight.x <= child.right && area.m_TopLeft.y >= child.top && area.m_BottomRight.y <= child.bottom)
+                    break;
             }
+            if (nChild < 4)
+                vChildItems[nChild].emplace_back(nPolygon);
+            else
+                vKeep.emplace_back(nPolygon);
         }
 
-        this->m_vList.clear();
-        this->m_vList = nl;
+        if (vKeep.size() < vItems.size()) {
+            m_vNodes[nNode].nFirstChild = static_cast<int32_t>(m_vNodes.size());
+            m_vNodes.insert(m_vNodes.end(), std::begin(vChildren), std::end(vChildren));
+            vItems.swap(vKeep);
+        }
     }
-}
 
-X2D::QuadTreeMapInfo::QuadTreeMapInfo(float width, float height)
-{
-    Pointf p1 = Pointf(0, 0);
-    Pointf p2 = Pointf(width, height);
-    m_Area = RectangleF(p1, p2);
-    m_MasterNode = Node(p1, p2, 0);
-}
+    m_vNodes[nNode].nFirstItem = static_cast<uint32_t>(m_vItemPolygon.size());
+    m_vNodes[nNode].nItemCount = static_cast<uint32_t>(vItems.size());
+    for (auto nPolygon : vItems) {
+        auto &area = m_vPolygons[nPolygon].m_Area;
+        m_vItemPolygon.emplace_back(nPolygon);
+        m_vItemLeft.emplace_back(area.m_TopLeft.x);
+        m_vItemTop.emplace_back(area.m_TopLeft.y);
+        m_vItemRight.emplace_back(area.m_BottomRight.x);
+        m_vItemBottom.emplace_back(area.m_BottomRight.y);
+    }
 
-void X2D::QuadTreeMapInfo::Enum(X2D::Pointf c, X2D::QuadTreeMapInfo::FunctorAdaptor &f)
-{
-    this->m_MasterNode.Enum(c, f);
+    auto nFirstChild = m_vNodes[nNode].nFirstChild;
+    if (nFirstChild < 0)
+        return;
+    for (int32_t i = 0; i < 4; ++i)
+        build(static_cast<uint32_t>(nFirstChild + i), vChildItems[i], static_cast<uint16_t>(depth + 1));
 }
 
-bool X2D::QuadTreeMapInfo::Add(MapLocationInfo u)
+template<typename BoxTest, typename PolygonTest>
+bool X2D::QuadTreeMapInfo::query(BoxTest &&boxTest, PolygonTest &&polygonTest)
 {
-    return m_MasterNode.Add(u);
-}
+    if (m_vNodes.empty()) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_vPolygons.size()); ++i) {
+            if (polygonTest(i))
+                return true;
+        }
+        return false;
+    }
 
-bool X2D::QuadTreeMapInfo::Collision(X2D::Pointf c)
-{
-    return m_MasterNode.Collision(c);
+    // Every level adds at most three nodes to the stack
+    int32_t vStack[4 * (QUADTREE_MAX_DEPTH + 1)];
+    int32_t nTop = 0;
+    vStack[nTop++] = 0;
+    while (nTop > 0) {
+        const auto &node = m_vNodes[vStack[--nTop]];
+        for (uint32_t i = node.nFirstItem, nEnd = node.nFirstItem + node.nItemCount; i < nEnd; ++i) {
+            if (boxTest(m_vItemLeft[i], m_vItemTop[i], m_vItemRight[i], m_vItemBottom[i]) && polygonTest(m_vItemPolygon[i]))
+                return true;
+        }
+
+        if (node.nFirstChild < 0)
+            continue;
+        for (int32_t i = 3; i >= 0; --i) {
+            const auto &child = m_vNodes[node.nFirstChild + i];
+            if (boxTest(child.left, child.top, child.right, child.bottom))
+                vStack[nTop++] = node.nFirstChild + i;
+        }
+    }
+    return false;
 }
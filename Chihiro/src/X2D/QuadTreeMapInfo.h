@@ -15,12 +15,17 @@
  *  You should have received a copy of the GNU General Public License along
  *  with this program. If not, see <http://www.gnu.org/licenses/>.
  */
-#include <map>
-
 #include "Common.h"
 #include "MapLocationInfo.h"
 
 namespace X2D {
+    /// \brief Polygons of the map, indexed by a quad tree laid out in flat arrays
+    /// Polygons are collected with Add while the map loads, Build then sorts them into the tree once.
+    /// Every node lives in one array with its four children next to each other, the polygons of a node
+    /// are a range of the item arrays which hold their bounding boxes side by side, so a query reads
+    /// contiguous memory and only runs the exact polygon test on boxes that match.
+    ///
+    /// Queries before Build test every polygon. Enum returns its results in the order of Add.
     class QuadTreeMapInfo {
     public:
         class FunctorAdaptor {
@@ -30,38 +35,37 @@ namespace X2D {
             std::vector<MapLocationInfo> pResult{};
         };
 
-        class Node {
-        public:
-            Node()
-                : init(true)
-            {
-            }
-
-            ~Node() = default;
-            Node(Pointf p1, Pointf p2, uint16_t depth);
-            bool Add(MapLocationInfo u);
-            void Enum(X2D::Pointf c, QuadTreeMapInfo::FunctorAdaptor &f);
-            bool Collision(X2D::Pointf c);
-            bool LooseCollision(Linef pLine);
-
-        private:
-            Node getFitNode(MapLocationInfo u);
-            void add(MapLocationInfo u);
-            void divide();
-            bool init{false};
-
-        public:
-            std::vector<MapLocationInfo> m_vList{};
-            RectangleF m_Area{};
-            std::map<int, Node> m_pNode{};
-            uint16_t m_unDepth{};
-        };
-
         QuadTreeMapInfo(float width, float height);
         void Enum(Pointf c, QuadTreeMapInfo::FunctorAdaptor &f);
         bool Add(MapLocationInfo u);
         bool Collision(X2D::Pointf c);
-        Node m_MasterNode{};
+        bool LooseCollision(Linef pLine);
+        /// \brief Builds the tree over everything added so far, called once the map is loaded
+        void Build();
+        const std::vector<MapLocationInfo> &GetPolygons() const { return m_vPolygons; }
+
         RectangleF m_Area{};
+
+    private:
+        struct Node {
+            float left, top, right, bottom;
+            int32_t nFirstChild; // index of the first of four children, -1 for a leaf
+            uint32_t nFirstItem;
+            uint32_t nItemCount;
+        };
+
+        template<typename BoxTest, typename PolygonTest>
+        bool query(BoxTest &&boxTest, PolygonTest &&polygonTest);
+        void build(uint32_t nNode, std::vector<uint32_t> &vItems, uint16_t depth);
+
+        std::vector<MapLocationInfo> m_vPolygons{};
+
+        std::vector<Node> m_vNodes{};
+        // One entry per polygon in node order
+        std::vector<uint32_t> m_vItemPolygon{};
+        std::vector<float> m_vItemLeft{};
+        std::vector<float> m_vItemTop{};
+        std::vector<float> m_vItemRight{};
+        std::vector<float> m_vItemBottom{};
     };
-}
\ No newline at end of file
+}
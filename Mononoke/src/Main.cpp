@@ -34,7 +34,7 @@ void StopDB();
 #define _MONONOKE_CORE_CONFIG "mononoke.conf"
 
 void SignalHandler(std::weak_ptr<NGemity::Asio::IoContext> ioContextRef, boost::system::error_code const &error, int /*signalNumber*/);
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error);
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error);
 
 int main(int argc, char **argv)
 {
@@ -71,18 +71,17 @@ int main(int argc, char **argv)
 #endif
     signals.async_wait(std::bind(&SignalHandler, std::weak_ptr<NGemity::Asio::IoContext>(ioContext), std::placeholders::_1, std::placeholders::_2));
 
-    // Enabled a timed callback for handling the database keep alive ping
-    int32_t dbPingInterval = sConfigMgr->GetIntDefault("MaxPingTime", 30);
-    std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
-    dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-    dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, std::weak_ptr<boost::asio::deadline_timer>(dbPingTimer), dbPingInterval, std::placeholders::_1));
+    // Enabled a timed callback for the database pools, they ping idle connections and adjust their size to the load
+    std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
+    dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+    dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, std::weak_ptr<boost::asio::deadline_timer>(dbMaintenanceTimer), std::placeholders::_1));
 
     // Start the io service worker loop
     ioContext->run();
 
     pGameNetwork->StopNetwork();
     pAuthNetwork->StopNetwork();
-    dbPingTimer->cancel();
+    dbMaintenanceTimer->cancel();
     signals.cancel();
 
     NG_LOG_INFO("server.authserver", "Stopping Mononoke...");
@@ -97,15 +96,14 @@ void SignalHandler(std::weak_ptr<NGemity::Asio::IoContext> ioContextRef, boost::
             ioContext->stop();
 }
 
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error)
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error)
 {
     if (!error) {
-        if (std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = dbPingTimerRef.lock()) {
-            NG_LOG_INFO("server.authserver", "Ping MySQL to keep connection alive");
-            LoginDatabase.KeepAlive();
+        if (std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = dbMaintenanceTimerRef.lock()) {
+            LoginDatabase.Maintain();
 
-            dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-            dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, dbPingTimerRef, dbPingInterval, std::placeholders::_1));
+            dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+            dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, dbMaintenanceTimerRef, std::placeholders::_1));
         }
     }
 }
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotAuthSession.h"
+
+#include "Bot.h"
+#include "BotStats.h"
+#include "Config.h"
+
+typedef struct {
+    int cmd;
+    std::function<void(NGemity::Bot *, XPacket *)> handler;
+} BotAuthHandler;
+
+template<typename T>
+BotAuthHandler declareHandler(void (NGemity::Bot::*handler)(const T *packet))
+{
+    BotAuthHandler handlerData{};
+    handlerData.cmd = T::getId(sConfigMgr->GetPacketVersion());
+    handlerData.handler = [handler](NGemity::Bot *instance, XPacket *packet) -> void {
+        T deserializedPacket;
+        MessageSerializerBuffer buffer(packet);
+        deserializedPacket.deserialize(&buffer);
+        (instance->*handler)(&deserializedPacket);
+    };
+    return handlerData;
+}
+
+ReadDataHandlerResult BotAuthSession::ProcessIncoming(XPacket *pRecvPct)
+{
+    ASSERT(pRecvPct);
+
+    // Built on first use, the packet version is only known once the config is loaded
+    static const BotAuthHandler authPacketHandler[] = {
+        declareHandler(&NGemity::Bot::onAuthResult),
+        declareHandler(&NGemity::Bot::onServerList),
+        declareHandler(&NGemity::Bot::onSelectServer),
+    };
+
+    sBotStats.AddReceived();
+    auto _cmd = pRecvPct->GetPacketID();
+    for (const auto &packetHandler : authPacketHandler) {
+        if ((uint16_t)packetHandler.cmd == _cmd) {
+            packetHandler.handler(m_pBot, pRecvPct);
+            break;
+        }
+    }
+    return ReadDataHandlerResult::Ok;
+}
+
+void BotAuthSession::OnClose()
+{
+    m_pBot->onDisconnect(this);
+}
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotGameSession.h"
+
+#include "Bot.h"
+#include "BotStats.h"
+#include "Config.h"
+
+typedef struct {
+    int cmd;
+    std::function<void(NGemity::Bot *, XPacket *)> handler;
+} BotGameHandler;
+
+template<typename T>
+BotGameHandler declareHandler(void (NGemity::Bot::*handler)(const T *packet))
+{
+    BotGameHandler handlerData{};
+    handlerData.cmd = T::getId(sConfigMgr->GetPacketVersion());
+    handlerData.handler = [handler](NGemity::Bot *instance, XPacket *packet) -> void {
+        T deserializedPacket;
+        MessageSerializerBuffer buffer(packet);
+        deserializedPacket.deserialize(&buffer);
+        (instance->*handler)(&deserializedPacket);
+    };
+    return handlerData;
+}
+
+ReadDataHandlerResult BotGameSession::ProcessIncoming(XPacket *pRecvPct)
+{
+    ASSERT(pRecvPct);
+
+    // Built on first use, the packet version is only known once the config is loaded
+    static const BotGameHandler gamePacketHandler[] = {
+        declareHandler(&NGemity::Bot::onResult),
+        declareHandler(&NGemity::Bot::onCharacterList),
+        declareHandler(&NGemity::Bot::onLoginResult),
+        declareHandler(&NGemity::Bot::onEnter),
+        declareHandler(&NGemity::Bot::onLeave),
+        declareHandler(&NGemity::Bot::onMove),
+        declareHandler(&NGemity::Bot::onChatLocal),
+        declareHandler(&NGemity::Bot::onAttackEvent),
+        declareHandler(&NGemity::Bot::onCantAttack),
+        declareHandler(&NGemity::Bot::onSkill),
+    };
+
+    // Everything else the world broadcasts is only counted
+    sBotStats.AddReceived();
+    auto _cmd = pRecvPct->GetPacketID();
+    for (const auto &packetHandler : gamePacketHandler) {
+        if ((uint16_t)packetHandler.cmd == _cmd) {
+            packetHandler.handler(m_pBot, pRecvPct);
+            break;
+        }
+    }
+    return ReadDataHandlerResult::Ok;
+}
+
+void BotGameSession::OnClose()
+{
+    m_pBot->onDisconnect(this);
+}
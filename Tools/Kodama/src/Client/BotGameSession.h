@@ -0,0 +1,45 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "Common.h"
+#include "XSocket.h"
+
+class XPacket;
+
+namespace NGemity {
+    class Bot;
+}
+
+// Game server connection of a bot
+class BotGameSession : public XSocket {
+public:
+    explicit BotGameSession(boost::asio::ip::tcp::socket &&socket, NGemity::Bot *pBot)
+        : XSocket(std::move(socket))
+        , m_pBot(pBot)
+    {
+    }
+
+    // Network handlers
+    void OnClose() override;
+    ReadDataHandlerResult ProcessIncoming(XPacket *) override;
+    bool IsEncrypted() const override { return true; }
+
+    NGemity::Bot *GetBot() const { return m_pBot; }
+
+private:
+    NGemity::Bot *m_pBot;
+};
@@ -0,0 +1,491 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Bot.h"
+
+#include "BotAuthSession.h"
+#include "BotGameSession.h"
+#include "BotManager.h"
+#include "BotStats.h"
+#include "Config.h"
+#include "Timer.h"
+#include "Util.h"
+#include "XDes.h"
+
+constexpr uint32_t BOT_LOGIN_TIMEOUT = 30000;
+constexpr uint32_t BOT_RESPONSE_TIMEOUT = 10000;
+constexpr uint32_t BOT_PING_INTERVAL = 10000;
+constexpr size_t BOT_MAX_PENDING = 32;
+
+NGemity::Bot::Bot(const std::string &szAccount, const BotProfile *pProfile)
+    : m_szAccount(szAccount)
+    , m_pProfile(pProfile)
+{
+}
+
+template<typename T>
+void NGemity::Bot::sendRequest(XSocket *pSocket, const T &packet, BotMetric eMetric)
+{
+    auto &vPending = m_vPending[eMetric];
+    if (vPending.size() >= BOT_MAX_PENDING) {
+        vPending.pop_front();
+        sBotStats.AddTimeout(eMetric);
+    }
+    vPending.emplace_back(getMSTime());
+
+    sBotStats.AddSent();
+    pSocket->SendPacket(packet);
+}
+
+void NGemity::Bot::onResponse(BotMetric eMetric, bool bSuccess)
+{
+    // Broadcasts we did not ask for (e.g. auto attack swings) have nothing to match
+    auto &vPending = m_vPending[eMetric];
+    if (vPending.empty())
+        return;
+
+    if (bSuccess)
+        sBotStats.AddLatency(eMetric, GetMSTimeDiffToNow(vPending.front()));
+    else
+        sBotStats.AddFailure(eMetric);
+    vPending.pop_front();
+}
+
+void NGemity::Bot::expirePending(uint32_t nTime)
+{
+    for (int32_t i = 0; i < BM_MAX; ++i) {
+        auto &vPending = m_vPending[i];
+        while (!vPending.empty() && getMSTimeDiff(vPending.front(), nTime) > BOT_RESPONSE_TIMEOUT) {
+            vPending.pop_front();
+            sBotStats.AddTimeout(static_cast<BotMetric>(i));
+        }
+    }
+}
+
+void NGemity::Bot::disconnect(uint32_t nTime)
+{
+    if (m_pAuthSession != nullptr)
+        m_pAuthSession->DelayedCloseSocket();
+    if (m_pGameSession != nullptr)
+        m_pGameSession->DelayedCloseSocket();
+    m_pAuthSession.reset();
+    m_pGameSession.reset();
+
+    for (int32_t i = 0; i < BM_MAX; ++i) {
+        for (size_t j = 0; j < m_vPending[i].size(); ++j)
+            sBotStats.AddTimeout(static_cast<BotMetric>(i));
+        m_vPending[i].clear();
+    }
+    m_vMonsters.clear();
+    m_nHandle = 0;
+    m_nRetryTime = nTime + m_nRetryDelay;
+    m_nState = BOT_OFFLINE;
+}
+
+bool NGemity::Bot::Start(const BotLoginInfo &loginInfo, uint32_t nTime)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_OFFLINE)
+        return true;
+
+    m_nServerIdx = loginInfo.nServerIdx;
+    m_nRetryDelay = loginInfo.nRetryDelay;
+
+    m_pAuthSession = sBotManager.Connect<BotAuthSession>(loginInfo.szAuthIP, loginInfo.nAuthPort, this);
+    if (m_pAuthSession == nullptr) {
+        m_nRetryTime = nTime + m_nRetryDelay;
+        return false;
+    }
+    sBotStats.AddConnect();
+    m_nState = BOT_AUTH;
+    m_nStateTime = nTime;
+
+    TS_CA_VERSION versionPct{};
+    versionPct.szVersion = loginInfo.szClientVersion;
+    sBotStats.AddSent();
+    m_pAuthSession->SendPacket(versionPct);
+
+    // Same DES key and buffer length Mononoke decrypts with
+    TS_CA_ACCOUNT accountPct{};
+    accountPct.account = m_szAccount;
+    int32_t nLength = sConfigMgr->GetPacketVersion() >= EPIC_5_1 ? 61 : 32;
+    memcpy(accountPct.passwordDes.password, loginInfo.szPassword.c_str(), std::min(static_cast<int32_t>(loginInfo.szPassword.size()), nLength - 1));
+    XDes::Encrypt("MERONG", accountPct.passwordDes.password, nLength);
+    sendRequest(m_pAuthSession.get(), accountPct, BM_LOGIN);
+    return true;
+}
+
+void NGemity::Bot::Update(uint32_t nTime)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+
+    switch (m_nState) {
+    case BOT_AUTH:
+    case BOT_LOBBY:
+        if (getMSTimeDiff(m_nStateTime, nTime) > BOT_LOGIN_TIMEOUT) {
+            NG_LOG_WARN("kodama", "Bot %s timed out while logging in.", m_szAccount.c_str());
+            disconnect(nTime);
+        }
+        break;
+    case BOT_SELECTED: {
+        // The auth leg is done, the game server only accepts the key for a short while
+        if (m_pAuthSession != nullptr)
+            m_pAuthSession->DelayedCloseSocket();
+        m_pAuthSession.reset();
+
+        m_pGameSession = sBotManager.Connect<BotGameSession>(m_szGameIP, m_nGamePort, this);
+        if (m_pGameSession == nullptr) {
+            disconnect(nTime);
+            break;
+        }
+        m_nState = BOT_LOBBY;
+        m_nStateTime = nTime;
+
+        TS_CS_ACCOUNT_WITH_AUTH authPct{};
+        authPct.account = m_szAccount;
+        authPct.one_time_key = m_nOneTimeKey;
+        sendRequest(m_pGameSession.get(), authPct, BM_GAME_AUTH);
+    } break;
+    case BOT_IN_GAME:
+        expirePending(nTime);
+        if (nTime >= m_nNextPing) {
+            TS_CS_PING pingPct{};
+            sBotStats.AddSent();
+            m_pGameSession->SendPacket(pingPct);
+            m_nNextPing = nTime + BOT_PING_INTERVAL;
+        }
+        if (nTime >= m_nNextAction) {
+            doAction(nTime);
+            m_nNextAction = nTime + m_pProfile->nActionInterval;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void NGemity::Bot::onAuthResult(const TS_AC_RESULT *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_AUTH || m_pAuthSession == nullptr)
+        return;
+
+    if (pRecv->result != TS_RESULT_SUCCESS) {
+        onResponse(BM_LOGIN, false);
+        NG_LOG_WARN("kodama", "Bot %s was refused by the auth server: %d", m_szAccount.c_str(), pRecv->result);
+        disconnect(getMSTime());
+        return;
+    }
+
+    onResponse(BM_LOGIN, true);
+    TS_CA_SERVER_LIST listPct{};
+    sBotStats.AddSent();
+    m_pAuthSession->SendPacket(listPct);
+}
+
+void NGemity::Bot::onServerList(const TS_AC_SERVER_LIST *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_AUTH || m_pAuthSession == nullptr)
+        return;
+
+    for (const auto &server : pRecv->servers) {
+        if (server.server_idx != m_nServerIdx)
+            continue;
+
+        m_szGameIP = server.server_ip;
+        m_nGamePort = static_cast<uint16_t>(server.server_port);
+
+        TS_CA_SELECT_SERVER selectPct{};
+        selectPct.server_idx = m_nServerIdx;
+        sendRequest(m_pAuthSession.get(), selectPct, BM_SELECT_SERVER);
+        return;
+    }
+
+    NG_LOG_ERROR("kodama", "Server %d is not in the server list.", m_nServerIdx);
+    disconnect(getMSTime());
+}
+
+void NGemity::Bot::onSelectServer(const TS_AC_SELECT_SERVER *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_AUTH)
+        return;
+
+    if (pRecv->result != TS_RESULT_SUCCESS) {
+        onResponse(BM_SELECT_SERVER, false);
+        disconnect(getMSTime());
+        return;
+    }
+
+    onResponse(BM_SELECT_SERVER, true);
+    m_nOneTimeKey = static_cast<uint64_t>(pRecv->one_time_key);
+    // Connecting blocks, leave it to the next Update instead of the network thread
+    m_nState = BOT_SELECTED;
+}
+
+void NGemity::Bot::onResult(const TS_SC_RESULT *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_pGameSession == nullptr)
+        return;
+
+    auto nVersion = sConfigMgr->GetPacketVersion();
+    bool bSuccess = pRecv->result == TS_RESULT_SUCCESS;
+    if (pRecv->request_msg_id == TS_CS_ACCOUNT_WITH_AUTH::getId(nVersion)) {
+        onResponse(BM_GAME_AUTH, bSuccess);
+        if (!bSuccess) {
+            NG_LOG_WARN("kodama", "Bot %s was refused by the game server: %d", m_szAccount.c_str(), pRecv->result);
+            disconnect(getMSTime());
+            return;
+        }
+
+        TS_CS_CHARACTER_LIST listPct{};
+        sendRequest(m_pGameSession.get(), listPct, BM_CHARACTER_LIST);
+    }
+    else if (pRecv->request_msg_id == TS_CS_LOGIN::getId(nVersion))
+        onResponse(BM_ENTER_WORLD, bSuccess);
+    else if (pRecv->request_msg_id == TS_CS_MOVE_REQUEST::getId(nVersion))
+        onResponse(BM_MOVE, bSuccess);
+    else if (pRecv->request_msg_id == TS_CS_CHAT_REQUEST::getId(nVersion))
+        onResponse(BM_CHAT, bSuccess);
+    else if (pRecv->request_msg_id == TS_CS_ATTACK_REQUEST::getId(nVersion))
+        onResponse(BM_ATTACK, bSuccess);
+    else if (pRecv->request_msg_id == TS_CS_SKILL::getId(nVersion))
+        onResponse(BM_SKILL, bSuccess);
+}
+
+void NGemity::Bot::onCharacterList(const TS_SC_CHARACTER_LIST *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_LOBBY || m_pGameSession == nullptr)
+        return;
+
+    if (pRecv->characters.empty()) {
+        onResponse(BM_CHARACTER_LIST, false);
+        NG_LOG_ERROR("kodama", "Bot %s has no character to log in with.", m_szAccount.c_str());
+        disconnect(getMSTime());
+        return;
+    }
+
+    onResponse(BM_CHARACTER_LIST, true);
+    TS_CS_LOGIN loginPct{};
+    loginPct.name = pRecv->characters.front().name;
+    loginPct.race = static_cast<uint8_t>(pRecv->characters.front().race);
+    sendRequest(m_pGameSession.get(), loginPct, BM_ENTER_WORLD);
+}
+
+void NGemity::Bot::onLoginResult(const TS_SC_LOGIN_RESULT *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (m_nState != BOT_LOBBY)
+        return;
+
+    onResponse(BM_ENTER_WORLD, true);
+    m_nHandle = pRecv->handle;
+    m_fX = m_fHomeX = pRecv->x;
+    m_fY = m_fHomeY = pRecv->y;
+    m_nLayer = pRecv->layer;
+    m_nState = BOT_IN_GAME;
+
+    // Spread the first action so a freshly ramped wave does not fire in lockstep
+    uint32_t nTime = getMSTime();
+    m_nNextAction = nTime + urand(0, m_pProfile->nActionInterval);
+    m_nNextPing = nTime + BOT_PING_INTERVAL;
+}
+
+void NGemity::Bot::onEnter(const TS_SC_ENTER *pRecv)
+{
+    if (pRecv->objType != EOT_Monster)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    m_vMonsters.emplace(pRecv->handle);
+}
+
+void NGemity::Bot::onLeave(const TS_SC_LEAVE *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    m_vMonsters.erase(pRecv->handle);
+}
+
+void NGemity::Bot::onMove(const TS_SC_MOVE *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pRecv->handle != m_nHandle || m_nHandle == 0)
+        return;
+
+    onResponse(BM_MOVE, true);
+    if (!pRecv->move_infos.empty()) {
+        m_fX = pRecv->move_infos.back().tx;
+        m_fY = pRecv->move_infos.back().ty;
+    }
+}
+
+void NGemity::Bot::onChatLocal(const TS_SC_CHAT_LOCAL *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pRecv->handle == m_nHandle && m_nHandle != 0)
+        onResponse(BM_CHAT, true);
+}
+
+void NGemity::Bot::onAttackEvent(const TS_SC_ATTACK_EVENT *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pRecv->attacker_handle == m_nHandle && m_nHandle != 0)
+        onResponse(BM_ATTACK, true);
+}
+
+void NGemity::Bot::onCantAttack(const TS_SC_CANT_ATTACK *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pRecv->attacker_handle != m_nHandle || m_nHandle == 0)
+        return;
+
+    onResponse(BM_ATTACK, false);
+    m_vMonsters.erase(pRecv->target_handle);
+}
+
+void NGemity::Bot::onSkill(const TS_SC_SKILL *pRecv)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pRecv->caster == m_nHandle && m_nHandle != 0)
+        onResponse(BM_SKILL, true);
+}
+
+void NGemity::Bot::onDisconnect(const XSocket *pSocket)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    if (pSocket == m_pAuthSession.get()) {
+        m_pAuthSession.reset();
+        // Closing the auth session is expected once the key is in hand
+        if (m_nState == BOT_AUTH)
+            disconnect(getMSTime());
+    }
+    else if (pSocket == m_pGameSession.get()) {
+        m_pGameSession.reset();
+        sBotStats.AddDisconnect();
+        disconnect(getMSTime());
+    }
+}
+
+NGemity::BotAction NGemity::Bot::rollAction() const
+{
+    int32_t nTotal = 0;
+    for (auto nWeight : m_pProfile->vActionWeight)
+        nTotal += nWeight;
+    if (nTotal <= 0)
+        return BA_IDLE;
+
+    int32_t nRoll = irand(0, nTotal - 1);
+    for (int32_t i = 0; i < BA_MAX; ++i) {
+        nRoll -= m_pProfile->vActionWeight[i];
+        if (nRoll < 0)
+            return static_cast<BotAction>(i);
+    }
+    return BA_IDLE;
+}
+
+void NGemity::Bot::doAction(uint32_t /*nTime*/)
+{
+    auto eAction = rollAction();
+    switch (eAction) {
+    case BA_MOVE:
+        doMove();
+        break;
+    case BA_CHAT:
+        doChat();
+        break;
+    case BA_ATTACK:
+        doAttack();
+        break;
+    case BA_SKILL:
+        doSkill();
+        break;
+    default:
+        break;
+    }
+    sBotStats.AddAction(eAction);
+}
+
+void NGemity::Bot::doMove()
+{
+    // Wander around the spawn point so the bots stay within their region
+    TS_CS_MOVE_REQUEST movePct{};
+    movePct.handle = m_nHandle;
+    movePct.x = m_fX;
+    movePct.y = m_fY;
+    movePct.cur_time = 0;
+    movePct.speed_sync = false;
+
+    MOVE_REQUEST_INFO moveInfo{};
+    moveInfo.tx = m_fHomeX + frand(-m_pProfile->fMoveRadius, m_pProfile->fMoveRadius);
+    moveInfo.ty = m_fHomeY + frand(-m_pProfile->fMoveRadius, m_pProfile->fMoveRadius);
+    movePct.move_infos.emplace_back(moveInfo);
+    sendRequest(m_pGameSession.get(), movePct, BM_MOVE);
+}
+
+void NGemity::Bot::doChat()
+{
+    TS_CS_CHAT_REQUEST chatPct{};
+    chatPct.type = CHAT_NORMAL;
+    chatPct.request_id = 0;
+    if (m_pProfile->vChatLines.empty())
+        chatPct.message = NGemity::StringFormat("{} checking in", m_szAccount);
+    else
+        chatPct.message = m_pProfile->vChatLines[urand(0, static_cast<uint32_t>(m_pProfile->vChatLines.size()) - 1)];
+    sendRequest(m_pGameSession.get(), chatPct, BM_CHAT);
+}
+
+void NGemity::Bot::doAttack()
+{
+    if (m_vMonsters.empty())
+        return;
+
+    auto itr = m_vMonsters.begin();
+    std::advance(itr, urand(0, static_cast<uint32_t>(m_vMonsters.size()) - 1));
+
+    TS_CS_ATTACK_REQUEST attackPct{};
+    attackPct.handle = m_nHandle;
+    attackPct.target_handle = *itr;
+    sendRequest(m_pGameSession.get(), attackPct, BM_ATTACK);
+}
+
+void NGemity::Bot::doSkill()
+{
+    if (m_pProfile->vSkills.empty())
+        return;
+
+    const auto &skill = m_pProfile->vSkills[urand(0, static_cast<uint32_t>(m_pProfile->vSkills.size()) - 1)];
+    uint32_t nTarget = m_nHandle;
+    if (!m_vMonsters.empty()) {
+        auto itr = m_vMonsters.begin();
+        std::advance(itr, urand(0, static_cast<uint32_t>(m_vMonsters.size()) - 1));
+        nTarget = *itr;
+    }
+
+    TS_CS_SKILL skillPct{};
+    skillPct.skill_id = skill.nSkillID;
+    skillPct.skill_level = skill.nSkillLevel;
+    skillPct.caster = m_nHandle;
+    skillPct.target = nTarget;
+    skillPct.x = m_fX;
+    skillPct.y = m_fY;
+    skillPct.z = 0;
+    skillPct.layer = static_cast<int8_t>(m_nLayer);
+    sendRequest(m_pGameSession.get(), skillPct, BM_SKILL);
+}
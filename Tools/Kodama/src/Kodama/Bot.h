@@ -0,0 +1,122 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+
+#include "Common.h"
+#include "KodamaStructs.h"
+#include "XPacket.h"
+
+class XSocket;
+class BotAuthSession;
+class BotGameSession;
+
+namespace NGemity {
+    enum BotState : uint8_t {
+        BOT_OFFLINE = 0, // Not connected, may be (re)started by the manager
+        BOT_AUTH,        // Logging in on the auth server
+        BOT_SELECTED,    // Got the one time key, game server not yet connected
+        BOT_LOBBY,       // Connected to the game server, picking a character
+        BOT_IN_GAME
+    };
+
+    /// \brief One headless client: walks through the auth and game login and then
+    /// keeps firing the actions of its profile against the world server.
+    /// Packet handlers run on the network thread, Update on the manager timer,
+    /// so every entry point takes the bot lock.
+    class Bot {
+    public:
+        Bot(const std::string &szAccount, const BotProfile *pProfile);
+        ~Bot() = default;
+        // Deleting the copy & assignment operators
+        // Better safe than sorry
+        Bot(const Bot &) = delete;
+        Bot &operator=(const Bot &) = delete;
+
+        /// \brief Connects to the auth server and sends the account
+        /// \return false if the auth server could not be reached
+        bool Start(const BotLoginInfo &loginInfo, uint32_t nTime);
+        /// \brief Advances the login, handles timeouts and fires the next action once it is due
+        void Update(uint32_t nTime);
+
+        BotState GetState() const { return m_nState; }
+        uint32_t GetRetryTime() const { return m_nRetryTime; }
+        const std::string &GetAccount() const { return m_szAccount; }
+
+        // Auth server
+        void onAuthResult(const TS_AC_RESULT *pRecv);
+        void onServerList(const TS_AC_SERVER_LIST *pRecv);
+        void onSelectServer(const TS_AC_SELECT_SERVER *pRecv);
+
+        // Game server
+        void onResult(const TS_SC_RESULT *pRecv);
+        void onCharacterList(const TS_SC_CHARACTER_LIST *pRecv);
+        void onLoginResult(const TS_SC_LOGIN_RESULT *pRecv);
+        void onEnter(const TS_SC_ENTER *pRecv);
+        void onLeave(const TS_SC_LEAVE *pRecv);
+        void onMove(const TS_SC_MOVE *pRecv);
+        void onChatLocal(const TS_SC_CHAT_LOCAL *pRecv);
+        void onAttackEvent(const TS_SC_ATTACK_EVENT *pRecv);
+        void onCantAttack(const TS_SC_CANT_ATTACK *pRecv);
+        void onSkill(const TS_SC_SKILL *pRecv);
+
+        void onDisconnect(const XSocket *pSocket);
+
+    private:
+        template<typename T>
+        void sendRequest(XSocket *pSocket, const T &packet, BotMetric eMetric);
+        void onResponse(BotMetric eMetric, bool bSuccess);
+        void expirePending(uint32_t nTime);
+        /// Drops both sessions and schedules a reconnect; expects the lock to be held
+        void disconnect(uint32_t nTime);
+
+        void doAction(uint32_t nTime);
+        BotAction rollAction() const;
+        void doMove();
+        void doChat();
+        void doAttack();
+        void doSkill();
+
+        std::string m_szAccount;
+        const BotProfile *m_pProfile;
+        std::atomic<BotState> m_nState{BOT_OFFLINE};
+        std::mutex m_pMutex;
+
+        std::shared_ptr<BotAuthSession> m_pAuthSession{nullptr};
+        std::shared_ptr<BotGameSession> m_pGameSession{nullptr};
+        uint16_t m_nServerIdx{0};
+        uint32_t m_nRetryDelay{0};
+        std::string m_szGameIP{};
+        uint16_t m_nGamePort{0};
+        uint64_t m_nOneTimeKey{0};
+
+        uint32_t m_nHandle{0};
+        float m_fX{0}, m_fY{0};
+        float m_fHomeX{0}, m_fHomeY{0};
+        uint8_t m_nLayer{0};
+        std::unordered_set<uint32_t> m_vMonsters{};
+
+        std::array<std::deque<uint32_t>, BM_MAX> m_vPending{};
+        uint32_t m_nStateTime{0};
+        uint32_t m_nNextAction{0};
+        uint32_t m_nNextPing{0};
+        std::atomic<uint32_t> m_nRetryTime{0};
+    };
+} // namespace NGemity
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotManager.h"
+
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include "BotStats.h"
+#include "Config.h"
+#include "Timer.h"
+#include "Util.h"
+
+bool NGemity::BotManager::InitializeBotManager()
+{
+    m_LoginInfo.szAuthIP = sConfigMgr->GetStringDefault("kodama.auth.ip", "127.0.0.1");
+    m_LoginInfo.nAuthPort = static_cast<uint16_t>(sConfigMgr->GetIntDefault("kodama.auth.port", 4500));
+    m_LoginInfo.szPassword = sConfigMgr->GetStringDefault("kodama.password", "kodama");
+    m_LoginInfo.szClientVersion = sConfigMgr->GetStringDefault("kodama.client_version", "200701120");
+    m_LoginInfo.nServerIdx = static_cast<uint16_t>(sConfigMgr->GetIntDefault("kodama.server_idx", 1));
+    m_LoginInfo.nRetryDelay = static_cast<uint32_t>(sConfigMgr->GetIntDefault("kodama.retry_delay", 5)) * 1000;
+
+    m_nTick = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("kodama.tick", 100), 10));
+    m_nSpawnPerTick = std::max(sConfigMgr->GetIntDefault("kodama.spawn_per_tick", 1), 1);
+    m_nReportInterval = static_cast<uint32_t>(std::max(sConfigMgr->GetIntDefault("kodama.report_interval", 10), 1)) * 1000;
+
+    if (!loadProfiles(sConfigMgr->GetStringDefault("kodama.profiles", "bot_profiles.json")))
+        return false;
+
+    auto szPrefix = sConfigMgr->GetStringDefault("kodama.account_prefix", "kodama");
+    int32_t nStart = sConfigMgr->GetIntDefault("kodama.account_start", 1);
+    int32_t nCount = sConfigMgr->GetIntDefault("kodama.bots", 10);
+    for (int32_t i = 0; i < nCount; ++i)
+        m_vBots.emplace_back(std::make_unique<Bot>(NGemity::StringFormat("{}{}", szPrefix, nStart + i), rollProfile()));
+
+    NG_LOG_INFO("kodama", "Created %d bots with %d profiles against %s:%d.", nCount, static_cast<int32_t>(m_vProfiles.size()), m_LoginInfo.szAuthIP.c_str(),
+        m_LoginInfo.nAuthPort);
+    return !m_vBots.empty();
+}
+
+bool NGemity::BotManager::loadProfiles(const std::string &szFileName)
+{
+    using json = nlohmann::json;
+    std::ifstream inFile(szFileName, std::ios::in);
+    if (!inFile.is_open()) {
+        // Without a profile file every bot just wanders, talks and fights whatever is around
+        NG_LOG_INFO("kodama", "No profile file %s, using the default profile.", szFileName.c_str());
+        BotProfile profile{};
+        profile.szName = "default";
+        profile.vActionWeight = {1, 3, 1, 2, 0};
+        m_vProfiles.emplace_back(profile);
+        return true;
+    }
+
+    json j;
+    try {
+        j = json::parse(inFile);
+    }
+    catch (json::exception &e) {
+        NG_LOG_ERROR("kodama", "Cannot parse %s: %s", szFileName.c_str(), e.what());
+        return false;
+    }
+    inFile.close();
+
+    for (auto &entry : j["profiles"]) {
+        BotProfile profile{};
+        profile.szName = entry.value("name", "unnamed");
+        profile.nWeight = entry.value("weight", 1);
+        profile.nActionInterval = std::max(entry.value("action_interval", 1000u), 100u);
+        profile.fMoveRadius = entry.value("move_radius", 48.0f);
+        for (int32_t i = 0; i < BA_MAX; ++i)
+            profile.vActionWeight[i] = entry.contains("actions") ? entry["actions"].value(BotActionName[i], 0) : 0;
+        if (entry.contains("skills")) {
+            for (auto &skill : entry["skills"])
+                profile.vSkills.emplace_back(BotSkill{skill.value("id", static_cast<uint16_t>(0)), skill.value("level", static_cast<int8_t>(1))});
+        }
+        if (entry.contains("chat")) {
+            for (auto &line : entry["chat"])
+                profile.vChatLines.emplace_back(line.get<std::string>());
+        }
+
+        if (profile.nWeight > 0)
+            m_vProfiles.emplace_back(profile);
+    }
+
+    if (m_vProfiles.empty()) {
+        NG_LOG_ERROR("kodama", "%s does not contain any usable profile.", szFileName.c_str());
+        return false;
+    }
+    return true;
+}
+
+const NGemity::BotProfile *NGemity::BotManager::rollProfile() const
+{
+    int32_t nTotal = 0;
+    for (const auto &profile : m_vProfiles)
+        nTotal += profile.nWeight;
+
+    int32_t nRoll = irand(0, nTotal - 1);
+    for (const auto &profile : m_vProfiles) {
+        nRoll -= profile.nWeight;
+        if (nRoll < 0)
+            return &profile;
+    }
+    return &m_vProfiles.back();
+}
+
+void NGemity::BotManager::InitializeBots(std::shared_ptr<NGemity::Asio::IoContext> pIoContext)
+{
+    if (!_stopped)
+        return;
+    _stopped = false;
+    _ioContext = pIoContext;
+    m_nNextReport = getMSTime() + m_nReportInterval;
+    _updateTimer = std::make_shared<boost::asio::deadline_timer>((*_ioContext.get()));
+    _updateTimer->expires_from_now(boost::posix_time::milliseconds(m_nTick));
+    _updateTimer->async_wait(std::bind(&NGemity::BotManager::Update, this));
+}
+
+void NGemity::BotManager::Update()
+{
+    if (_stopped)
+        return;
+
+    uint32_t nTime = getMSTime();
+
+    // Ramp up: only a few logins per tick so the auth server is not hit by the whole wave at once
+    int32_t nStarted = 0;
+    for (auto &bot : m_vBots) {
+        if (nStarted >= m_nSpawnPerTick)
+            break;
+        if (bot->GetState() != BOT_OFFLINE || nTime < bot->GetRetryTime())
+            continue;
+        bot->Start(m_LoginInfo, nTime);
+        ++nStarted;
+    }
+
+    for (auto &bot : m_vBots)
+        bot->Update(nTime);
+
+    if (nTime >= m_nNextReport) {
+        m_nNextReport = nTime + m_nReportInterval;
+        writeReport();
+    }
+
+    // Rearm only once done, the io context runs on several threads
+    _updateTimer->expires_from_now(boost::posix_time::milliseconds(m_nTick));
+    _updateTimer->async_wait(std::bind(&NGemity::BotManager::Update, this));
+}
+
+void NGemity::BotManager::writeReport()
+{
+    int32_t nOnline = 0;
+    for (auto &bot : m_vBots) {
+        if (bot->GetState() == BOT_IN_GAME)
+            ++nOnline;
+    }
+
+    std::ofstream outFile(sConfigMgr->GetStringDefault("kodama.outfile", "/tmp/kodama.json"));
+    outFile << sBotStats.Report(nOnline, static_cast<int32_t>(m_vBots.size()));
+    outFile.close();
+}
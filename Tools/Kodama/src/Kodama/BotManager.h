@@ -0,0 +1,87 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "Bot.h"
+#include "Common.h"
+#include "IoContext.h"
+#include "KodamaStructs.h"
+#include "NetworkThread.h"
+#include "SingleSocketInstance.h"
+
+namespace NGemity {
+    /// \brief Owns every bot, ramps them up and drives them from a single timer
+    class BotManager {
+    public:
+        static BotManager &Instance()
+        {
+            static BotManager instance;
+            return instance;
+        }
+
+        ~BotManager() = default;
+        // Deleting the copy & assignment operators
+        // Better safe than sorry
+        BotManager(const BotManager &) = delete;
+        BotManager &operator=(const BotManager &) = delete;
+
+        /// \brief Reads the login settings, the behaviour profiles and creates the bots
+        /// \return false if there is nothing to run
+        bool InitializeBotManager();
+        void InitializeBots(std::shared_ptr<NGemity::Asio::IoContext> pIoContext);
+        void Update();
+
+        /// \brief Connects a new session for pBot and hands it to the network thread
+        template<class SOCKET_TYPE>
+        std::shared_ptr<SOCKET_TYPE> Connect(const std::string &szIPAddress, uint16_t nPort, Bot *pBot)
+        {
+            boost::asio::ip::tcp_endpoint endpoint(NGemity::Net::make_address_v4(szIPAddress), nPort);
+            boost::asio::ip::tcp::socket socket(*(_ioContext.get()));
+            try {
+                socket.connect(endpoint);
+                socket.set_option(boost::asio::ip::tcp::no_delay(true));
+            }
+            catch (std::exception &) {
+                NG_LOG_ERROR("network", "Cannot connect to %s:%d", szIPAddress.c_str(), nPort);
+                return nullptr;
+            }
+
+            auto session = std::make_shared<SOCKET_TYPE>(std::move(socket), pBot);
+            NGemity::SingleSocketInstance::Instance().AddSocket(session);
+            return session;
+        }
+
+    private:
+        BotManager() = default;
+
+        bool loadProfiles(const std::string &szFileName);
+        const BotProfile *rollProfile() const;
+        void writeReport();
+
+        BotLoginInfo m_LoginInfo{};
+        std::vector<BotProfile> m_vProfiles{};
+        std::vector<std::unique_ptr<Bot>> m_vBots{};
+        uint32_t m_nTick{100};
+        int32_t m_nSpawnPerTick{1};
+        uint32_t m_nReportInterval{10000};
+        uint32_t m_nNextReport{0};
+
+        std::shared_ptr<NGemity::Asio::IoContext> _ioContext;
+        std::shared_ptr<boost::asio::deadline_timer> _updateTimer;
+        bool _stopped{true};
+    };
+} // namespace NGemity
+#define sBotManager NGemity::BotManager::Instance()
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotStats.h"
+
+#include <nlohmann/json.hpp>
+
+#include "Log.h"
+#include "Timer.h"
+
+NGemity::BotStats::BotStats()
+    : m_nStartTime(getMSTime())
+    , m_nLastReportTime(getMSTime())
+{
+}
+
+void NGemity::BotStats::LatencyHistogram::Add(uint32_t nMSec)
+{
+    uint32_t nBucket = nMSec < FINE_BUCKETS ? nMSec : FINE_BUCKETS + std::min((nMSec - FINE_BUCKETS) / COARSE_WIDTH, COARSE_BUCKETS - 1);
+    ++vBuckets[nBucket];
+
+    if (nCount == 0 || nMSec < nMin)
+        nMin = nMSec;
+    if (nMSec > nMax)
+        nMax = nMSec;
+    ++nCount;
+    nSum += nMSec;
+}
+
+uint32_t NGemity::BotStats::LatencyHistogram::Percentile(double fRatio) const
+{
+    if (nCount == 0)
+        return 0;
+
+    auto nRank = static_cast<uint64_t>(fRatio * static_cast<double>(nCount - 1)) + 1;
+    uint64_t nSeen = 0;
+    for (uint32_t i = 0; i < vBuckets.size(); ++i) {
+        nSeen += vBuckets[i];
+        if (nSeen >= nRank)
+            return std::min(i < FINE_BUCKETS ? i : FINE_BUCKETS + (i - FINE_BUCKETS) * COARSE_WIDTH, nMax);
+    }
+    return nMax;
+}
+
+void NGemity::BotStats::AddLatency(BotMetric eMetric, uint32_t nMSec)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    m_vHistogram[eMetric].Add(nMSec);
+}
+
+void NGemity::BotStats::AddFailure(BotMetric eMetric)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    ++m_vHistogram[eMetric].nFailures;
+}
+
+void NGemity::BotStats::AddTimeout(BotMetric eMetric)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    ++m_vHistogram[eMetric].nTimeouts;
+}
+
+std::string NGemity::BotStats::Report(int32_t nOnline, int32_t nTotal)
+{
+    uint32_t nNow = getMSTime();
+    double fElapsed = std::max(getMSTimeDiff(m_nLastReportTime, nNow), 1u) / 1000.0;
+    uint64_t nSent = m_nSent;
+    uint64_t nReceived = m_nReceived;
+    double fSentRate = (nSent - m_nLastSent) / fElapsed;
+    double fReceivedRate = (nReceived - m_nLastReceived) / fElapsed;
+    m_nLastSent = nSent;
+    m_nLastReceived = nReceived;
+    m_nLastReportTime = nNow;
+
+    NG_LOG_INFO("kodama", "Bots online: %d/%d, connects: %d, disconnects: %d, sent: %.1f pkt/s, received: %.1f pkt/s", nOnline, nTotal,
+        static_cast<int32_t>(m_nConnects.load()), static_cast<int32_t>(m_nDisconnects.load()), fSentRate, fReceivedRate);
+
+    nlohmann::json root;
+    root["last_update"] = time(nullptr);
+    root["uptime"] = getMSTimeDiff(m_nStartTime, nNow) / 1000;
+    root["bots_online"] = nOnline;
+    root["bots_total"] = nTotal;
+    root["connects"] = m_nConnects.load();
+    root["disconnects"] = m_nDisconnects.load();
+    root["packets_sent"] = nSent;
+    root["packets_received"] = nReceived;
+    root["sent_per_second"] = fSentRate;
+    root["received_per_second"] = fReceivedRate;
+    for (int32_t i = 0; i < BA_MAX; ++i)
+        root["actions"][BotActionName[i]] = m_nActions[i].load();
+
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    for (int32_t i = 0; i < BM_MAX; ++i) {
+        const auto &histogram = m_vHistogram[i];
+        if (histogram.nCount == 0 && histogram.nFailures == 0 && histogram.nTimeouts == 0)
+            continue;
+
+        uint32_t nAvg = histogram.nCount != 0 ? static_cast<uint32_t>(histogram.nSum / histogram.nCount) : 0;
+        NG_LOG_INFO("kodama", "%-15s count: %8d, min: %5d, avg: %5d, p50: %5d, p95: %5d, p99: %5d, max: %5d, failed: %d, timeout: %d", BotMetricName[i],
+            static_cast<int32_t>(histogram.nCount), histogram.nMin, nAvg, histogram.Percentile(0.50), histogram.Percentile(0.95), histogram.Percentile(0.99), histogram.nMax,
+            static_cast<int32_t>(histogram.nFailures), static_cast<int32_t>(histogram.nTimeouts));
+
+        nlohmann::json metric;
+        metric["count"] = histogram.nCount;
+        metric["min"] = histogram.nMin;
+        metric["avg"] = nAvg;
+        metric["p50"] = histogram.Percentile(0.50);
+        metric["p95"] = histogram.Percentile(0.95);
+        metric["p99"] = histogram.Percentile(0.99);
+        metric["max"] = histogram.nMax;
+        metric["failed"] = histogram.nFailures;
+        metric["timeout"] = histogram.nTimeouts;
+        root["latency"][BotMetricName[i]] = metric;
+    }
+    return root.dump();
+}
@@ -0,0 +1,93 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <atomic>
+#include <mutex>
+
+#include "Common.h"
+#include "KodamaStructs.h"
+
+namespace NGemity {
+    /// \brief Latency and throughput counters shared by every bot
+    /// Latencies are kept in a fixed bucket histogram: 1ms wide up to one second,
+    /// 100ms wide up to ten seconds, so percentiles never need the raw samples.
+    class BotStats {
+    public:
+        static BotStats &Instance()
+        {
+            static BotStats instance;
+            return instance;
+        }
+
+        ~BotStats() = default;
+        // Deleting the copy & assignment operators
+        // Better safe than sorry
+        BotStats(const BotStats &) = delete;
+        BotStats &operator=(const BotStats &) = delete;
+
+        void AddLatency(BotMetric eMetric, uint32_t nMSec);
+        void AddFailure(BotMetric eMetric);
+        void AddTimeout(BotMetric eMetric);
+        void AddAction(BotAction eAction) { ++m_nActions[eAction]; }
+
+        void AddSent() { ++m_nSent; }
+        void AddReceived() { ++m_nReceived; }
+        void AddConnect() { ++m_nConnects; }
+        void AddDisconnect() { ++m_nDisconnects; }
+
+        /// \brief Logs a summary of everything recorded so far
+        /// \param nOnline bots currently in game
+        /// \param nTotal bots configured
+        /// \return the same summary as json, for the report file
+        std::string Report(int32_t nOnline, int32_t nTotal);
+
+    private:
+        BotStats();
+
+        static constexpr uint32_t FINE_BUCKETS = 1000;
+        static constexpr uint32_t COARSE_BUCKETS = 90;
+        static constexpr uint32_t COARSE_WIDTH = 100;
+
+        struct LatencyHistogram {
+            std::array<uint64_t, FINE_BUCKETS + COARSE_BUCKETS> vBuckets{};
+            uint64_t nCount{0};
+            uint64_t nSum{0};
+            uint32_t nMin{0};
+            uint32_t nMax{0};
+            uint64_t nFailures{0};
+            uint64_t nTimeouts{0};
+
+            void Add(uint32_t nMSec);
+            uint32_t Percentile(double fRatio) const;
+        };
+
+        std::array<LatencyHistogram, BM_MAX> m_vHistogram{};
+        std::mutex m_pMutex;
+
+        std::array<std::atomic<uint64_t>, BA_MAX> m_nActions{};
+        std::atomic<uint64_t> m_nSent{0};
+        std::atomic<uint64_t> m_nReceived{0};
+        std::atomic<uint64_t> m_nConnects{0};
+        std::atomic<uint64_t> m_nDisconnects{0};
+
+        uint32_t m_nStartTime;
+        uint32_t m_nLastReportTime;
+        uint64_t m_nLastSent{0};
+        uint64_t m_nLastReceived{0};
+    };
+} // namespace NGemity
+#define sBotStats NGemity::BotStats::Instance()
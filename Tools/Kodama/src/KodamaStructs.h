@@ -0,0 +1,68 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <array>
+
+#include "Common.h"
+
+namespace NGemity {
+    /// Every request/response pair the bots time, in report order
+    enum BotMetric : uint8_t {
+        BM_LOGIN = 0,
+        BM_SELECT_SERVER,
+        BM_GAME_AUTH,
+        BM_CHARACTER_LIST,
+        BM_ENTER_WORLD,
+        BM_MOVE,
+        BM_CHAT,
+        BM_ATTACK,
+        BM_SKILL,
+        BM_MAX
+    };
+
+    constexpr const char *BotMetricName[BM_MAX] = {"login", "select_server", "game_auth", "character_list", "enter_world", "move", "chat", "attack", "skill"};
+
+    enum BotAction : uint8_t { BA_IDLE = 0, BA_MOVE, BA_CHAT, BA_ATTACK, BA_SKILL, BA_MAX };
+
+    constexpr const char *BotActionName[BA_MAX] = {"idle", "move", "chat", "attack", "skill"};
+
+    struct BotSkill {
+        uint16_t nSkillID;
+        int8_t nSkillLevel;
+    };
+
+    /// Where and how every bot logs in
+    struct BotLoginInfo {
+        std::string szAuthIP;
+        uint16_t nAuthPort;
+        std::string szPassword;
+        std::string szClientVersion;
+        uint16_t nServerIdx;
+        uint32_t nRetryDelay; // ms before a dropped bot logs in again
+    };
+
+    /// Scripted behaviour shared by every bot that rolled this profile
+    struct BotProfile {
+        std::string szName;
+        int32_t nWeight{1};
+        uint32_t nActionInterval{1000}; // ms between two actions
+        float fMoveRadius{48.0f};
+        std::array<int32_t, BA_MAX> vActionWeight{};
+        std::vector<BotSkill> vSkills{};
+        std::vector<std::string> vChatLines{};
+    };
+} // namespace NGemity
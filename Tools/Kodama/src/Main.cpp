@@ -0,0 +1,28 @@
+#include <iostream>
+
+#include "BotManager.h"
+#include "Common.h"
+#include "NGInit.h"
+#include "NetworkThread.h"
+#include "SingleSocketInstance.h"
+#include "XSocket.h"
+
+int main(int argc, char **argv)
+{
+    auto [bSuccess, ioContext] = NGemity::InitFramework("kodama.conf", "Kodama", argc, argv);
+    if (!bSuccess) {
+        return -1;
+    }
+
+    // Game.PacketVersion has to match the servers the bots are pointed at
+    if (!sBotManager.InitializeBotManager())
+        return 1;
+
+    NGemity::SingleSocketInstance::Instance().InitializeSingleSocketInstance();
+    sBotManager.InitializeBots(ioContext);
+    auto threadPool = NGemity::GetThreadPool(ioContext);
+
+    ioContext->run();
+
+    return 0;
+}
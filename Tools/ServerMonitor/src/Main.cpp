@@ -13,7 +13,7 @@
 
 bool StartDB();
 void StopDB();
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error);
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error);
 
 int main(int argc, char **argv)
 {
@@ -31,11 +31,10 @@ int main(int argc, char **argv)
         return 1;
     std::shared_ptr<void> sDBHandler(nullptr, [](void *) { StopDB(); });
 
-    // Enabled a timed callback for handling the database keep alive ping
-    int32_t dbPingInterval = sConfigMgr->GetIntDefault("MaxPingTime", 30);
-    std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
-    dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-    dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, std::weak_ptr<boost::asio::deadline_timer>(dbPingTimer), dbPingInterval, std::placeholders::_1));
+    // Enabled a timed callback for the database pool, it pings idle connections and adjusts its size to the load
+    std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = std::make_shared<boost::asio::deadline_timer>(*ioContext);
+    dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+    dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, std::weak_ptr<boost::asio::deadline_timer>(dbMaintenanceTimer), std::placeholders::_1));
 
     sServerMonitor.InitializeMonitoring(ioContext);
     auto threadPool = NGemity::GetThreadPool(ioContext);
@@ -68,15 +67,14 @@ void StopDB()
     MySQL::Library_End();
 }
 
-void KeepDatabaseAliveHandler(std::weak_ptr<boost::asio::deadline_timer> dbPingTimerRef, int32_t dbPingInterval, boost::system::error_code const &error)
+void DatabaseMaintenanceHandler(std::weak_ptr<boost::asio::deadline_timer> dbMaintenanceTimerRef, boost::system::error_code const &error)
 {
     if (!error) {
-        if (std::shared_ptr<boost::asio::deadline_timer> dbPingTimer = dbPingTimerRef.lock()) {
-            NG_LOG_INFO("server.authserver", "Ping MySQL to keep connection alive");
-            LoginDatabase.KeepAlive();
+        if (std::shared_ptr<boost::asio::deadline_timer> dbMaintenanceTimer = dbMaintenanceTimerRef.lock()) {
+            LogDatabase.Maintain();
 
-            dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
-            dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, dbPingTimerRef, dbPingInterval, std::placeholders::_1));
+            dbMaintenanceTimer->expires_from_now(boost::posix_time::seconds(1));
+            dbMaintenanceTimer->async_wait(std::bind(&DatabaseMaintenanceHandler, dbMaintenanceTimerRef, std::placeholders::_1));
         }
     }
 }
\ No newline at end of file
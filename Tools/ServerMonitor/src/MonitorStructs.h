@@ -27,6 +27,7 @@ namespace NGemity {
         int32_t nPlayerCount;
         uint16_t nPort;
         bool bRequesterEnabled;
+        std::string szMetricsFile; // Metrics.File of that game server, optional
     };
 
     struct ServerRegion {
@@ -50,6 +50,7 @@ void NGemity::ServerMonitor::InitializeServerMonitor()
             server.szIPAddress = vServer["ip"].get<std::string>();
             server.szName = vServer["name"].get<std::string>();
             server.nPort = vServer["port"].get<uint16_t>();
+            server.szMetricsFile = vServer.value("metrics", "");
             serverRegion.vServerList.emplace_back(server);
         }
         m_vServerRegion.emplace_back(serverRegion);
@@ -132,6 +133,12 @@ std::string NGemity::ServerMonitor::GetEverything()
             region_server["name"] = server.szName;
             region_server["usercount"] = server.nPlayerCount;
             region_server["requester"] = server.bRequesterEnabled;
+            if (!server.szMetricsFile.empty()) {
+                std::ifstream metricsFile(server.szMetricsFile, std::ios::in);
+                auto metrics = nlohmann::json::parse(metricsFile, nullptr, false);
+                if (!metrics.is_discarded())
+                    region_server["metrics"] = metrics;
+            }
             region["server"].push_back(region_server);
         }
         root["servers"].push_back(region);
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BatchStatement.h"
+
+#include <algorithm>
+
+#include "Log.h"
+#include "PreparedStatement.h"
+#include "Transaction.h"
+
+BatchStatement::BatchStatement(uint32_t rowIndex, uint32_t batchIndex, uint32_t batchSize, BatchLayout layout)
+    : m_rowIndex(rowIndex)
+    , m_batchIndex(batchIndex)
+    , m_batchSize(batchSize)
+    , m_layout(layout)
+{
+}
+
+BatchStatement::~BatchStatement()
+{
+    for (auto *row : m_rows)
+        delete row;
+}
+
+BatchStatement::BatchStatement(BatchStatement &&right) noexcept
+    : m_rowIndex(right.m_rowIndex)
+    , m_batchIndex(right.m_batchIndex)
+    , m_batchSize(right.m_batchSize)
+    , m_layout(right.m_layout)
+    , m_rows(std::move(right.m_rows))
+{
+    right.m_rows.clear();
+}
+
+void BatchStatement::Append(PreparedStatement *row)
+{
+    if (!m_rows.empty() && row->statement_data.size() != m_rows.front()->statement_data.size()) {
+        NG_LOG_ERROR("sql.sql", "BatchStatement: row of statement %u has %u parameters instead of %u, row skipped.", m_rowIndex, static_cast<uint32_t>(row->statement_data.size()),
+            static_cast<uint32_t>(m_rows.front()->statement_data.size()));
+        delete row;
+        return;
+    }
+    m_rows.push_back(row);
+}
+
+void BatchStatement::AppendTo(SQLTransaction &trans)
+{
+    std::size_t i = 0;
+    if (m_batchSize > 1) {
+        for (; i + m_batchSize <= m_rows.size(); i += m_batchSize)
+            trans->Append(merge(i));
+    }
+
+    //! The rest is too short for the merged statement and goes out row by row
+    for (; i < m_rows.size(); ++i) {
+        trans->Append(m_rows[i]);
+        m_rows[i] = nullptr;
+    }
+
+    for (auto *row : m_rows)
+        delete row;
+    m_rows.clear();
+}
+
+PreparedStatement *BatchStatement::merge(std::size_t first)
+{
+    auto *stmt = new PreparedStatement(m_batchIndex);
+    auto const rowSize = m_rows[first]->statement_data.size();
+
+    if (m_layout == BATCH_ROWS) {
+        stmt->statement_data.reserve(rowSize * m_batchSize);
+        for (uint32_t i = 0; i < m_batchSize; ++i) {
+            auto const &row = m_rows[first + i]->statement_data;
+            stmt->statement_data.insert(stmt->statement_data.end(), row.begin(), row.end());
+        }
+        return stmt;
+    }
+
+    //! The key is the last parameter, like the WHERE of the single row UPDATE
+    auto const key = rowSize - 1;
+    stmt->statement_data.reserve((2 * key + 1) * m_batchSize);
+    for (std::size_t column = 0; column < key; ++column) {
+        for (uint32_t i = 0; i < m_batchSize; ++i) {
+            auto const &row = m_rows[first + i]->statement_data;
+            stmt->statement_data.push_back(row[key]);
+            stmt->statement_data.push_back(row[column]);
+        }
+    }
+    for (uint32_t i = 0; i < m_batchSize; ++i)
+        stmt->statement_data.push_back(m_rows[first + i]->statement_data[key]);
+    return stmt;
+}
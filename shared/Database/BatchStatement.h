@@ -0,0 +1,53 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <vector>
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+
+/*! Merges rows of one single row statement into multi row statements.
+    The multi row variant holds exactly batchSize rows. Every full batchSize rows go out as one
+    merged statement, the rows left over go out as their single row statement. */
+class BatchStatement {
+public:
+    BatchStatement(uint32_t rowIndex, uint32_t batchIndex, uint32_t batchSize, BatchLayout layout);
+    ~BatchStatement();
+
+    BatchStatement(BatchStatement &&right) noexcept;
+    BatchStatement &operator=(BatchStatement &&right) = delete;
+
+    //! Takes the ownership of a statement prepared with the row index
+    void Append(PreparedStatement *row);
+
+    //! Moves the merged statements into the transaction, the batch is empty afterwards
+    void AppendTo(SQLTransaction &trans);
+
+    std::size_t GetRowCount() const { return m_rows.size(); }
+
+private:
+    PreparedStatement *merge(std::size_t first);
+
+    uint32_t m_rowIndex;
+    uint32_t m_batchIndex;
+    uint32_t m_batchSize;
+    BatchLayout m_layout;
+    std::vector<PreparedStatement *> m_rows;
+
+    BatchStatement(BatchStatement const &right) = delete;
+    BatchStatement &operator=(BatchStatement const &right) = delete;
+};
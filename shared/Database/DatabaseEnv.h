@@ -16,6 +16,7 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include "BatchStatement.h"
 #include "DatabaseWorkerPool.h"
 #include "Define.h"
 #include "Field.h"
@@ -26,6 +27,7 @@
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryResult.h"
+#include "RowReader.h"
 #include "Transaction.h"
 
 /// Accessor to the character database
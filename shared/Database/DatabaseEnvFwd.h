@@ -25,6 +25,9 @@ typedef std::shared_ptr<ResultSet> QueryResult;
 typedef std::future<QueryResult> QueryResultFuture;
 typedef std::promise<QueryResult> QueryResultPromise;
 
+class ResultStream;
+typedef std::unique_ptr<ResultStream> QueryResultStream;
+
 class PreparedStatement;
 
 class PreparedResultSet;
@@ -34,8 +37,20 @@ typedef std::promise<PreparedQueryResult> PreparedQueryResultPromise;
 
 class QueryCallback;
 
+class BatchStatement;
+
+//! How the parameters of the rows are laid out in the multi row statement
+enum BatchLayout {
+    BATCH_ROWS,        //! Rows one after the other, see MySQLConnection::PrepareBatchStatement
+    BATCH_KEYED_UPDATE //! Per column key/value pairs then the keys, see MySQLConnection::PrepareKeyedUpdateStatement
+};
+
 class Transaction;
 typedef std::shared_ptr<Transaction> SQLTransaction;
+typedef std::future<bool> TransactionFuture;
+typedef std::promise<bool> TransactionPromise;
+
+class TransactionCallback;
 
 class SQLQueryHolder;
 typedef std::future<SQLQueryHolder *> QueryResultHolderFuture;
@@ -17,8 +17,10 @@
 
 #include "DatabaseLoader.h"
 
+#include <algorithm>
 #include <mysqld_error.h>
 
+#include "Common.h"
 #include "Config.h"
 #include "DatabaseEnv.h"
 #include "Log.h"
@@ -53,7 +55,12 @@ DatabaseLoader &DatabaseLoader::AddDatabase(DatabaseWorkerPool<T> &pool, std::st
 
         uint8_t const synchThreads = uint8_t(sConfigMgr->GetIntDefault((name + "Database.SynchThreads").c_str(), 1));
 
+        uint8_t const maxAsyncThreads = uint8_t(std::clamp(sConfigMgr->GetIntDefault(name + "Database.MaxWorkerThreads", asyncThreads), int32_t(asyncThreads), 32));
+
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetMaxAsyncThreads(maxAsyncThreads);
+        pool.SetIdlePingInterval(uint32_t(std::max(sConfigMgr->GetIntDefault("MaxPingTime", 30), 1)) * MINUTE);
+        pool.SetBatchSize(uint32_t(std::clamp(sConfigMgr->GetIntDefault(name + "Database.BatchSize", 16), 1, 64)));
         if (auto error = pool.Open() != 0) {
             NG_LOG_ERROR("sql.driver",
                 "\nDatabasePool %s NOT opened. There were errors opening the MySQL connections. Check your SQLDriverLogFile "
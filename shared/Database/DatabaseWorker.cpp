@@ -17,14 +17,23 @@
 
 #include "DatabaseWorker.h"
 
+#include "Metrics.h"
+#include "MySQLConnection.h"
 #include "ProducerConsumerQueue.h"
+#include "StringFormat.h"
 #include "SQLOperation.h"
 
+constexpr std::chrono::milliseconds WORKER_IDLE_WAKEUP{1000};
+
 DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation *> *newQueue, MySQLConnection *connection)
 {
     _connection = connection;
     _queue = newQueue;
     _cancelationToken = false;
+    _retireToken = false;
+    _retired = false;
+    _queueWait = 0;
+    _operations = 0;
     _workerThread = std::thread(&DatabaseWorker::WorkerThread, this);
 }
 
@@ -32,7 +41,9 @@ DatabaseWorker::~DatabaseWorker()
 {
     _cancelationToken = true;
 
-    _queue->Cancel();
+    //! A retired worker already left, the queue still feeds the others
+    if (!_retired)
+        _queue->Cancel();
 
     _workerThread.join();
 }
@@ -42,17 +53,41 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    // Time from Enqueue until the operation is done, waiting in the queue included
+    auto &asyncTime = sMetrics.GetHistogram(NGemity::StringFormat("db.{}.async_us", _connection->GetDatabaseName()));
+
     for (;;) {
         SQLOperation *operation = nullptr;
 
-        _queue->WaitAndPop(operation);
+        //! Wake up now and then, so an idle connection gets pinged and a retired worker leaves
+        if (!_queue->WaitAndPop(operation, WORKER_IDLE_WAKEUP)) {
+            if (_cancelationToken || _queue->IsCanceled())
+                return;
+            if (_retireToken)
+                break;
+
+            _connection->PingIfIdle();
+            continue;
+        }
 
         if (_cancelationToken || !operation)
             return;
 
+        auto tStart = std::chrono::steady_clock::now();
+        _queueWait += std::chrono::duration_cast<std::chrono::microseconds>(tStart - operation->m_tQueued).count();
+        ++_operations;
+
         operation->SetConnection(_connection);
         operation->call();
+        if (operation->m_pOrder != nullptr)
+            operation->m_pOrder->Done(operation->m_nOrderKey);
+        asyncTime.Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - operation->m_tQueued).count());
 
         delete operation;
+
+        if (_retireToken)
+            break;
     }
+
+    _retired = true;
 }
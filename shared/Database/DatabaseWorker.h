@@ -17,6 +17,7 @@
  */
 #include <atomic>
 #include <thread>
+#include <utility>
 
 #include "Define.h"
 
@@ -31,6 +32,15 @@ public:
     DatabaseWorker(ProducerConsumerQueue<SQLOperation *> *newQueue, MySQLConnection *connection);
     ~DatabaseWorker();
 
+    //! Leave after the current operation, without cancelling the queue shared with the other workers
+    void Retire() { _retireToken = true; }
+    bool IsRetiring() const { return _retireToken; }
+    //! The thread has left and the connection can be closed
+    bool IsRetired() const { return _retired; }
+
+    //! Returns the summed queue wait in microseconds and the operation count since the last call
+    std::pair<uint64_t, uint64_t> TakeQueueWait() { return {_queueWait.exchange(0), _operations.exchange(0)}; }
+
 private:
     ProducerConsumerQueue<SQLOperation *> *_queue;
     MySQLConnection *_connection;
@@ -39,6 +49,10 @@ private:
     std::thread _workerThread;
 
     std::atomic<bool> _cancelationToken;
+    std::atomic<bool> _retireToken;
+    std::atomic<bool> _retired;
+    std::atomic<uint64_t> _queueWait;
+    std::atomic<uint64_t> _operations;
 
     DatabaseWorker(DatabaseWorker const &right) = delete;
     DatabaseWorker &operator=(DatabaseWorker const &right) = delete;
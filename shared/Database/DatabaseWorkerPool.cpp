@@ -17,14 +17,19 @@
 
 #include "DatabaseWorkerPool.h"
 
+#include <algorithm>
+
 #include "AdhocStatement.h"
+#include "BatchStatement.h"
 #include "Common.h"
+#include "DatabaseWorker.h"
 #include "Errors.h"
 #include "Implementation/CharacterDatabase.h"
 #include "Implementation/GameDatabase.h"
 #include "Implementation/LogDatabase.h"
 #include "Implementation/LoginDatabase.h"
 #include "Log.h"
+#include "Metrics.h"
 #include "PreparedStatement.h"
 #include "ProducerConsumerQueue.h"
 #include "QueryCallback.h"
@@ -45,20 +50,21 @@
 #define MIN_MARIADB_SERVER_VERSION 100804u
 #define MIN_MARIADB_CLIENT_VERSION 30303u
 
-class PingOperation : public SQLOperation {
-    //! Operation for idle delaythreads
-    bool Execute() override
-    {
-        m_conn->Ping();
-        return true;
-    }
-};
+//! Another asynchronous connection is opened above this many queued operations per connection
+#define POOL_GROW_DEPTH 8u
+//! or when operations waited longer than this in the queue on average
+#define POOL_GROW_WAIT_US 50000u
+//! An asynchronous connection is closed after this many Maintain calls without a backlog
+#define POOL_SHRINK_CHECKS 30u
 
 template<class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
     : _queue(new ProducerConsumerQueue<SQLOperation *>())
     , _async_threads(0)
     , _synch_threads(0)
+    , _max_async_threads(0)
+    , _idleChecks(0)
+    , _order(new SQLOrderTracker())
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 #ifdef NG_MARIADB
@@ -75,6 +81,8 @@ DatabaseWorkerPool<T>::DatabaseWorkerPool()
 template<class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
+    if (_growThread.joinable())
+        _growThread.join();
     _queue->Cancel();
 }
 
@@ -85,6 +93,27 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string const &infoString, uin
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
+    _max_async_threads = asyncThreads;
+}
+
+template<class T>
+void DatabaseWorkerPool<T>::SetMaxAsyncThreads(uint8_t const maxAsyncThreads)
+{
+    _max_async_threads = std::max(maxAsyncThreads, _async_threads);
+}
+
+template<class T>
+void DatabaseWorkerPool<T>::SetIdlePingInterval(uint32_t const seconds)
+{
+    WPFatal(_connectionInfo.get(), "Connection info was not set!");
+    _connectionInfo->idlePingInterval = seconds;
+}
+
+template<class T>
+void DatabaseWorkerPool<T>::SetBatchSize(uint32_t const batchSize)
+{
+    WPFatal(_connectionInfo.get(), "Connection info was not set!");
+    _connectionInfo->batchSize = batchSize;
 }
 
 template<class T>
@@ -94,8 +123,8 @@ uint32_t DatabaseWorkerPool<T>::Open()
 
     NG_LOG_INFO("sql.driver",
         "Opening DatabasePool '%s'. "
-        "Asynchronous connections: %u, synchronous connections: %u.",
-        GetDatabaseName(), _async_threads, _synch_threads);
+        "Asynchronous connections: %u (up to %u), synchronous connections: %u.",
+        GetDatabaseName(), _async_threads, _max_async_threads, _synch_threads);
 
     uint32_t error = OpenConnections(IDX_ASYNC, _async_threads);
 
@@ -105,6 +134,10 @@ uint32_t DatabaseWorkerPool<T>::Open()
     error = OpenConnections(IDX_SYNCH, _synch_threads);
 
     if (!error) {
+        _syncTime = &sMetrics.GetHistogram(NGemity::StringFormat("db.{}.sync_us", GetDatabaseName()));
+        sMetrics.RegisterSampler(NGemity::StringFormat("db.{}.queue", GetDatabaseName()), [this]() { return static_cast<int64_t>(_queue->Size()); });
+        _asyncCount = &sMetrics.GetGauge(NGemity::StringFormat("db.{}.async_connections", GetDatabaseName()));
+        _asyncCount->Set(static_cast<int64_t>(_connections[IDX_ASYNC].size()));
         NG_LOG_INFO("sql.driver", "DatabasePool '%s' opened successfully. " SZFMTD " total connections running.", GetDatabaseName(), (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size()));
     }
 
@@ -116,8 +149,17 @@ void DatabaseWorkerPool<T>::Close()
 {
     NG_LOG_INFO("sql.driver", "Closing down DatabasePool '%s'.", GetDatabaseName());
 
+    sMetrics.UnregisterSampler(NGemity::StringFormat("db.{}.queue", GetDatabaseName()));
+
+    //! Wait for a connection that is still being opened, it adds itself to the pool
+    if (_growThread.joinable())
+        _growThread.join();
+
     //! Closes the actualy MySQL connection.
-    _connections[IDX_ASYNC].clear();
+    {
+        std::lock_guard<std::mutex> lock(_asyncLock);
+        _connections[IDX_ASYNC].clear();
+    }
 
     NG_LOG_INFO("sql.driver",
         "Asynchronous connections on DatabasePool '%s' terminated. "
@@ -146,6 +188,9 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
             }
             else
                 connection->Unlock();
+
+            //! Asynchronous connections only start taking work once their statements exist
+            connection->StartWorker();
         }
 
     return true;
@@ -157,7 +202,11 @@ QueryResult DatabaseWorkerPool<T>::Query(const char *sql, T *connection /*= null
     if (!connection)
         connection = GetFreeConnection();
 
-    ResultSet *result = connection->Query(sql);
+    ResultSet *result;
+    {
+        NGemity::Metrics::ScopedTimer queryTimer(*_syncTime);
+        result = connection->Query(sql);
+    }
     connection->Unlock();
     if (!result || !result->GetRowCount() || !result->NextRow()) {
         delete result;
@@ -171,7 +220,11 @@ template<class T>
 PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement *stmt)
 {
     auto connection = GetFreeConnection();
-    PreparedResultSet *ret = connection->Query(stmt);
+    PreparedResultSet *ret;
+    {
+        NGemity::Metrics::ScopedTimer queryTimer(*_syncTime);
+        ret = connection->Query(stmt);
+    }
     connection->Unlock();
 
     //! Delete proxy-class. Not needed anymore
@@ -186,32 +239,46 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement *stmt)
 }
 
 template<class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(const char *sql)
+QueryResultStream DatabaseWorkerPool<T>::StreamQuery(const char *sql)
+{
+    T *connection = GetFreeConnection();
+    ResultStream *stream = connection->StreamQuery(sql);
+    if (!stream) {
+        connection->Unlock();
+        return nullptr;
+    }
+
+    //! The stream unlocks the connection
+    return QueryResultStream(stream);
+}
+
+template<class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(const char *sql, SQLOperationLane lane /*= SQL_LANE_INTERACTIVE*/)
 {
     BasicStatementTask *task = new BasicStatementTask(sql, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, lane);
     return QueryCallback(std::move(result));
 }
 
 template<class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement *stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement *stmt, SQLOperationLane lane /*= SQL_LANE_INTERACTIVE*/)
 {
     PreparedStatementTask *task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, lane);
     return QueryCallback(std::move(result));
 }
 
 template<class T>
-QueryResultHolderFuture DatabaseWorkerPool<T>::DelayQueryHolder(SQLQueryHolder *holder)
+QueryResultHolderFuture DatabaseWorkerPool<T>::DelayQueryHolder(SQLQueryHolder *holder, SQLOperationLane lane /*= SQL_LANE_INTERACTIVE*/)
 {
     SQLQueryHolderTask *task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, lane);
     return result;
 }
 
@@ -243,6 +310,16 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction transaction)
     Enqueue(new TransactionTask(transaction));
 }
 
+template<class T>
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction transaction)
+{
+    TransactionWithResultTask *task = new TransactionWithResultTask(transaction);
+    // Store future result before enqueueing - task might get already processed and deleted before returning from this method
+    TransactionFuture result = task->GetFuture();
+    Enqueue(task);
+    return TransactionCallback(std::move(result));
+}
+
 template<class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction &transaction)
 {
@@ -288,22 +365,97 @@ void DatabaseWorkerPool<T>::EscapeString(std::string &str)
 }
 
 template<class T>
-void DatabaseWorkerPool<T>::KeepAlive()
+BatchStatement DatabaseWorkerPool<T>::BeginBatch(PreparedStatementIndex rowIndex, PreparedStatementIndex batchIndex, BatchLayout layout)
+{
+    return BatchStatement(rowIndex, batchIndex, _connectionInfo->batchSize, layout);
+}
+
+template<class T>
+void DatabaseWorkerPool<T>::ExecuteBatch(BatchStatement &batch)
+{
+    if (batch.GetRowCount() == 0)
+        return;
+
+    SQLTransaction trans = BeginTransaction();
+    batch.AppendTo(trans);
+    CommitTransaction(trans);
+}
+
+template<class T>
+void DatabaseWorkerPool<T>::Maintain()
 {
     //! Ping synchronous connections
     for (auto &connection : _connections[IDX_SYNCH]) {
         if (connection->LockIfReady()) {
-            connection->Ping();
+            connection->PingIfIdle();
             connection->Unlock();
         }
     }
 
-    //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
-    //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
-    //! as the sole purpose is to prevent connections from idling.
-    auto const count = _connections[IDX_ASYNC].size();
-    for (uint8_t i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+    std::lock_guard<std::mutex> lock(_asyncLock);
+    auto &connections = _connections[IDX_ASYNC];
+
+    //! Close the connections whose worker has left
+    connections.erase(std::remove_if(connections.begin(), connections.end(), [](std::unique_ptr<T> const &connection) { return connection->IsRetired(); }), connections.end());
+
+    uint64_t queueWait = 0, operations = 0;
+    size_t active = 0;
+    for (auto &connection : connections) {
+        if (connection->IsRetiring())
+            continue;
+        ++active;
+        if (DatabaseWorker *worker = connection->GetWorker()) {
+            auto [wait, count] = worker->TakeQueueWait();
+            queueWait += wait;
+            operations += count;
+        }
+    }
+
+    size_t const depth = _queue->Size();
+    uint64_t const averageWait = operations != 0 ? queueWait / operations : 0;
+
+    if (depth > active * POOL_GROW_DEPTH || averageWait > POOL_GROW_WAIT_US) {
+        _idleChecks = 0;
+        if (active < _max_async_threads && GrowAsync())
+            NG_LOG_INFO("sql.driver", "DatabasePool '%s' is backing up (" SZFMTD " queued, " UI64FMTD " us average wait), opening asynchronous connection " SZFMTD ".",
+                GetDatabaseName(), depth, averageWait, active + 1);
+    }
+    else if (depth == 0 && ++_idleChecks >= POOL_SHRINK_CHECKS) {
+        _idleChecks = 0;
+        if (active > _async_threads) {
+            auto it = std::find_if(connections.rbegin(), connections.rend(), [](std::unique_ptr<T> const &connection) { return !connection->IsRetiring(); });
+            (*it)->RetireWorker();
+            NG_LOG_INFO("sql.driver", "DatabasePool '%s' is idle, closing asynchronous connection " SZFMTD ".", GetDatabaseName(), active);
+        }
+    }
+
+    _asyncCount->Set(static_cast<int64_t>(active));
+}
+
+template<class T>
+bool DatabaseWorkerPool<T>::GrowAsync()
+{
+    if (_growing)
+        return false;
+
+    // The previous connection is published already, _growing is only cleared after that
+    if (_growThread.joinable())
+        _growThread.join();
+
+    _growing = true;
+    _growThread = std::thread([this] {
+        auto connection = NGemity::make_unique<T>(_queue.get(), *_connectionInfo);
+        if (connection->Open() != 0 || !connection->PrepareStatements()) {
+            NG_LOG_ERROR("sql.driver", "DatabasePool '%s' could not open another asynchronous connection.", GetDatabaseName());
+        }
+        else {
+            std::lock_guard<std::mutex> lock(_asyncLock);
+            connection->StartWorker();
+            _connections[IDX_ASYNC].push_back(std::move(connection));
+        }
+        _growing = false;
+    });
+    return true;
 }
 
 template<class T>
@@ -350,9 +502,25 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char *to, const char *from, un
 }
 
 template<class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation *op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation *op, SQLOperationLane lane /*= SQL_LANE_BULK*/)
 {
-    _queue->Push(op);
+    op->m_tQueued = std::chrono::steady_clock::now();
+    if (uint32_t key = _orderKey; key != 0)
+    {
+        // A read must not see the state from before the writes of its key that are still queued
+        if (lane == SQL_LANE_INTERACTIVE && _order->IsPending(key))
+            lane = SQL_LANE_BULK;
+        if (lane == SQL_LANE_BULK)
+        {
+            op->m_pOrder = _order.get();
+            op->m_nOrderKey = key;
+            _order->Add(key);
+        }
+    }
+    if (lane == SQL_LANE_INTERACTIVE)
+        _queue->PushPriority(op);
+    else
+        _queue->Push(op);
 }
 
 template<class T>
@@ -16,7 +16,10 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 #include <array>
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "DatabaseEnvFwd.h"
@@ -27,8 +30,18 @@ template<typename T>
 class ProducerConsumerQueue;
 
 class SQLOperation;
+class SQLOrderTracker;
 struct MySQLConnectionInfo;
 
+namespace NGemity::Metrics {
+    class Gauge;
+    class Histogram;
+}
+
+//! Interactive operations (a player waits for them) are served before bulk ones (saves, logs).
+//! Under an OrderScope an interactive operation waits for the bulk ones of its key, see DatabaseWorkerPool::OrderScope.
+enum SQLOperationLane : uint8_t { SQL_LANE_BULK, SQL_LANE_INTERACTIVE };
+
 template<class T>
 class DatabaseWorkerPool {
 private:
@@ -42,6 +55,15 @@ public:
 
     void SetConnectionInfo(std::string const &infoString, uint8_t const asyncThreads, uint8_t const synchThreads);
 
+    //! Lets Maintain grow the asynchronous connections up to maxAsyncThreads while the queue backs up
+    void SetMaxAsyncThreads(uint8_t const maxAsyncThreads);
+
+    //! Seconds a connection may stay unused before it is pinged
+    void SetIdlePingInterval(uint32_t const seconds);
+
+    //! Rows per multi row statement, has to be set before the statements are prepared
+    void SetBatchSize(uint32_t const batchSize);
+
     uint32_t Open();
 
     void Close();
@@ -132,24 +154,29 @@ public:
     //! Statement must be prepared with CONNECTION_SYNCH flag.
     PreparedQueryResult Query(PreparedStatement *stmt);
 
+    //! Runs an SQL query in string format and returns before any row was read, rows are fetched as the caller reads them.
+    //! The stream keeps one synchronous connection busy until it is destroyed, see RowReader.
+    //! Returns nullptr if the query failed.
+    QueryResultStream StreamQuery(const char *sql);
+
     /**
             Asynchronous query (with resultset) methods.
        */
 
     //! Enqueues a query in string format that will set the value of the QueryResultFuture return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
-    QueryCallback AsyncQuery(const char *sql);
+    QueryCallback AsyncQuery(const char *sql, SQLOperationLane lane = SQL_LANE_INTERACTIVE);
 
     //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    QueryCallback AsyncQuery(PreparedStatement *stmt);
+    QueryCallback AsyncQuery(PreparedStatement *stmt, SQLOperationLane lane = SQL_LANE_INTERACTIVE);
 
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder *holder);
+    QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder *holder, SQLOperationLane lane = SQL_LANE_INTERACTIVE);
 
     /**
             Transaction context methods.
@@ -162,6 +189,9 @@ public:
     //! were appended to the transaction will be respected during execution.
     void CommitTransaction(SQLTransaction transaction);
 
+    //! Enqueues a transaction like CommitTransaction, the returned callback tells whether it was committed.
+    TransactionCallback AsyncCommitTransaction(SQLTransaction transaction);
+
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
     void DirectCommitTransaction(SQLTransaction &transaction);
@@ -188,15 +218,43 @@ public:
     //! Apply escape string'ing for current collation. (utf8)
     void EscapeString(std::string &str);
 
-    //! Keeps all our MySQL connections alive, prevent the server from disconnecting us.
-    void KeepAlive();
+    //! Begins a batch that merges rows of rowIndex into statements of batchIndex, see BatchStatement.
+    //! batchIndex must be prepared with PrepareBatchStatement for BATCH_ROWS or with PrepareKeyedUpdateStatement
+    //! for BATCH_KEYED_UPDATE, both with CONNECTION_ASYNC flag.
+    BatchStatement BeginBatch(PreparedStatementIndex rowIndex, PreparedStatementIndex batchIndex, BatchLayout layout = BATCH_ROWS);
+
+    //! Enqueues the merged statements of the batch in a transaction of their own.
+    void ExecuteBatch(BatchStatement &batch);
+
+    //! Pings idle synchronous connections and resizes the asynchronous ones to the load, call about once per second.
+    //! Asynchronous connections ping themselves from their worker.
+    void Maintain();
+
+    //! Orders the asynchronous operations the current thread enqueues while it is alive by key, e.g. an account id.
+    //! An interactive operation does not overtake the queued or running bulk operations of its key, it is queued behind them instead.
+    class OrderScope {
+    public:
+        explicit OrderScope(uint32_t key) : _previous(_orderKey) { _orderKey = key; }
+        ~OrderScope() { _orderKey = _previous; }
+
+        // Better safe than sorry
+        OrderScope(OrderScope const &) = delete;
+        OrderScope &operator=(OrderScope const &) = delete;
+
+    private:
+        uint32_t _previous;
+    };
 
 private:
     uint32_t OpenConnections(InternalIndex type, uint8_t numConnections);
 
     unsigned long EscapeString(char *to, const char *from, unsigned long length);
 
-    void Enqueue(SQLOperation *op);
+    void Enqueue(SQLOperation *op, SQLOperationLane lane = SQL_LANE_BULK);
+
+    //! Starts opening one more asynchronous connection on _growThread, _asyncLock must be held.
+    //! The connection is added under _asyncLock once it is open, so a slow server never holds the lock.
+    bool GrowAsync();
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -209,4 +267,14 @@ private:
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     uint8_t _async_threads, _synch_threads;
+    uint8_t _max_async_threads;
+    std::mutex _asyncLock; //! Guards _connections[IDX_ASYNC] once the pool is open
+    std::thread _growThread;
+    std::atomic<bool> _growing{false};
+    uint32_t _idleChecks;
+    std::unique_ptr<SQLOrderTracker> _order;
+    //! Order key of the OrderScope of this thread, 0 outside of one
+    static inline thread_local uint32_t _orderKey{0};
+    NGemity::Metrics::Histogram *_syncTime{nullptr};
+    NGemity::Metrics::Gauge *_asyncCount{nullptr};
 };
\ No newline at end of file
@@ -27,11 +27,12 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PrepareStatement(CHARACTER_GET_CHARACTERLIST,
         "SELECT sid, name, race, sex, lv, jlv, exp, hp, mp, job, permission, skin_color, model_00, model_01, model_02, model_03, model_04, CONVERT(create_time, char) AS create_time, "
         "CONVERT(delete_time, char) AS delete_time FROM `Character` WHERE account_id = ? AND `name` NOT LIKE '@%' ORDER BY sid",
-        CONNECTION_SYNCH);
+        CONNECTION_ASYNC);
     PrepareStatement(CHARACTER_GET_WEARINFO,
-        "SELECT wear_info, code, enhance, level FROM Item WHERE account_id = 0 AND owner_id = ? AND summon_id = 0 AND auction_id = 0 AND keeping_id = 0 AND wear_info > -1 AND wear_info < 22 ORDER BY "
-        "update_time",
-        CONNECTION_SYNCH);
+        "SELECT Item.owner_id, Item.wear_info, Item.code, Item.enhance, Item.level FROM Item JOIN `Character` ON `Character`.sid = Item.owner_id WHERE `Character`.account_id = ? AND "
+        "`Character`.`name` NOT LIKE '@%' AND Item.account_id = 0 AND Item.summon_id = 0 AND Item.auction_id = 0 AND Item.keeping_id = 0 AND Item.wear_info > -1 AND Item.wear_info < 22 ORDER BY "
+        "Item.update_time",
+        CONNECTION_ASYNC);
     PrepareStatement(CHARACTER_GET_CHARACTER,
         "SELECT sid, account, permission, party_id, guild_id, x, y, z, layer, race, sex, lv, exp, hp, mp, stamina, havoc, job_depth, jp, job_0, job_1, job_2, jlv_0, jlv_1, jlv_2, immoral_point, cha, "
         "pkc, dkc, summon_0, summon_1, summon_2, summon_3, summon_4, summon_5, skin_color, model_00, model_01, model_02, model_03, model_04, belt_00, belt_01, belt_02, belt_03, belt_04, belt_05, "
@@ -42,8 +43,8 @@ void CharacterDatabaseConnection::DoPrepareStatements()
         "INSERT INTO `Character` "
         "(`name`,account,account_id,slot,x,y,z,layer,race,sex,lv,job,jlv,exp,hp,mp,skin_color,model_00,model_01,model_02,model_03,model_04,create_time,login_time,logout_time,otp_date,delete_time,sid,"
         "client_info,stamina,jp)VALUES(?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?, NOW(),NOW(),NOW(),NOW(),CONVERT( '9999-12-31 23:59:59', DATETIME ),?,'QS=0,0,2,0|QS=0,1,2,2|QS=0,11,2,1|',100,0)",
-        CONNECTION_SYNCH);
-    PrepareStatement(CHARACTER_GET_NAMECHECK, "SELECT 1 FROM `Character` WHERE name = ?", CONNECTION_SYNCH);
+        CONNECTION_ASYNC);
+    PrepareStatement(CHARACTER_GET_NAMECHECK, "SELECT 1 FROM `Character` WHERE name = ?", CONNECTION_ASYNC);
     PrepareStatement(CHARACTER_UPD_CHARACTER,
         "UPDATE `Character` SET x = ?, y = ?, z = ?, layer = ?, exp = ?, lv = ?, hp = ?, mp = ?, stamina = ?, jlv = ?, jp = ?, total_jp = ?, job_0 = ?, job_1 = ?, job_2 = ?, jlv_0 = ?, jlv_1 = ?, "
         "jlv_2 = ?, permission = ?, job = ?, gold = ?, party_id = ?, guild_id = ?, summon_0 = ?, summon_1 = ?, summon_2 = ?, summon_3 = ?, summon_4 = ?, summon_5 = ?, main_summon = ?, sub_summon = "
@@ -95,6 +96,15 @@ void CharacterDatabaseConnection::DoPrepareStatements()
         "AND keeping_id = 0",
         CONNECTION_SYNCH);
     PrepareStatement(CHARACTER_UPD_STORAGE_GOLD, "UPDATE Item SET cnt = ? WHERE account_id = ? AND owner_id = 0 AND auction_id = 0 AND keeping_id = 0 AND code = 0", CONNECTION_ASYNC);
+
+    // Rows take the parameters of their single row statement above, in the same order.
+    // CHARACTER_UPD_ITEM stays an update, an item whose row is gone is not written again.
+    PrepareKeyedUpdateStatement(CHARACTER_UPD_ITEM_BATCH, "`Item`", "sid",
+        {"owner_id", "account_id", "summon_id", "auction_id", "keeping_id", "idx", "cnt", "level", "enhance", "flag", "wear_info", "socket_0", "socket_1", "socket_2", "socket_3", "remain_time"},
+        "update_time = NOW()", CONNECTION_ASYNC);
+    PrepareBatchStatement(CHARACTER_REP_SKILL_BATCH, "REPLACE INTO Skill VALUES ", "(?,?,?,?,?,?)", "", CONNECTION_ASYNC);
+    PrepareBatchStatement(CHARACTER_ADD_QUEST_BATCH, "REPLACE INTO Quest VALUES ", "(?, ?, ?, ?, ?, ?, ?, ?)", "", CONNECTION_ASYNC);
+    PrepareBatchStatement(CHARACTER_REP_STATE_BATCH, "REPLACE INTO State VALUES ", "(?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?)", "", CONNECTION_ASYNC);
 }
 
 CharacterDatabaseConnection::CharacterDatabaseConnection(MySQLConnectionInfo &connInfo)
@@ -40,6 +40,11 @@ name for a suiting suffix.
     CHARACTER_DEL_PARTY,
     CHARACTER_GET_STORAGE,
     CHARACTER_UPD_STORAGE_GOLD,
+    // Multi row variants of the save statements, see BatchStatement
+    CHARACTER_UPD_ITEM_BATCH,
+    CHARACTER_REP_SKILL_BATCH,
+    CHARACTER_ADD_QUEST_BATCH,
+    CHARACTER_REP_STATE_BATCH,
     MAX_CHARACTERDATABASE_STATEMENTS,
 };
 
@@ -57,6 +57,7 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo &connInfo)
     , m_Mysql(NULL)
     , m_connectionInfo(connInfo)
     , m_connectionFlags(CONNECTION_SYNCH)
+    , m_lastUsed(std::chrono::steady_clock::now())
 {
 }
 
@@ -67,8 +68,8 @@ MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation *> *queue, M
     , m_Mysql(NULL)
     , m_connectionInfo(connInfo)
     , m_connectionFlags(CONNECTION_ASYNC)
+    , m_lastUsed(std::chrono::steady_clock::now())
 {
-    m_worker = NGemity::make_unique<DatabaseWorker>(m_queue, this);
 }
 
 MySQLConnection::~MySQLConnection()
@@ -170,6 +171,8 @@ bool MySQLConnection::Execute(const char *sql)
     if (!m_Mysql)
         return false;
 
+    _Touch();
+
     {
         uint32_t _s = getMSTime();
 
@@ -196,6 +199,8 @@ bool MySQLConnection::Execute(PreparedStatement *stmt)
     if (!m_Mysql)
         return false;
 
+    _Touch();
+
     uint32_t index = stmt->m_index;
     {
         MySQLPreparedStatement *m_mStmt = GetPreparedStatement(index);
@@ -244,6 +249,8 @@ bool MySQLConnection::_Query(PreparedStatement *stmt, MYSQL_RES **pResult, uint6
     if (!m_Mysql)
         return false;
 
+    _Touch();
+
     uint32_t index = stmt->m_index;
     {
         MySQLPreparedStatement *m_mStmt = GetPreparedStatement(index);
@@ -308,11 +315,41 @@ ResultSet *MySQLConnection::Query(const char *sql)
     return new ResultSet(result, fields, rowCount, fieldCount);
 }
 
+ResultStream *MySQLConnection::StreamQuery(const char *sql)
+{
+    if (!m_Mysql || !sql)
+        return NULL;
+
+    _Touch();
+
+    uint32_t _s = getMSTime();
+    if (mysql_query(m_Mysql, sql)) {
+        uint32_t lErrno = mysql_errno(m_Mysql);
+        NG_LOG_INFO("sql.sql", "SQL: %s", sql);
+        NG_LOG_ERROR("sql.sql", "[%u] %s", lErrno, mysql_error(m_Mysql));
+
+        if (_HandleMySQLErrno(lErrno)) // If it returns true, an error was handled successfully (i.e. reconnection)
+            return StreamQuery(sql); // We try again
+
+        return NULL;
+    }
+    NG_LOG_DEBUG("sql.sql", "[%u ms] SQL (streamed): %s", getMSTimeDiff(_s, getMSTime()), sql);
+
+    //! Unlike mysql_store_result nothing is read yet, rows come in as they are fetched
+    MYSQL_RES *result = mysql_use_result(m_Mysql);
+    if (!result)
+        return NULL;
+
+    return new ResultStream(this, result, mysql_field_count(m_Mysql));
+}
+
 bool MySQLConnection::_Query(const char *sql, MYSQL_RES **pResult, MYSQL_FIELD **pFields, uint64_t *pRowCount, uint32_t *pFieldCount)
 {
     if (!m_Mysql)
         return false;
 
+    _Touch();
+
     {
         uint32_t _s = getMSTime();
 
@@ -408,6 +445,35 @@ int MySQLConnection::ExecuteTransaction(SQLTransaction &transaction)
 void MySQLConnection::Ping()
 {
     mysql_ping(m_Mysql);
+    _Touch();
+}
+
+void MySQLConnection::PingIfIdle()
+{
+    if (std::chrono::steady_clock::now() - m_lastUsed.load() >= std::chrono::seconds(m_connectionInfo.idlePingInterval))
+        Ping();
+}
+
+void MySQLConnection::StartWorker()
+{
+    if (m_queue && !m_worker)
+        m_worker = NGemity::make_unique<DatabaseWorker>(m_queue, this);
+}
+
+void MySQLConnection::RetireWorker()
+{
+    if (m_worker)
+        m_worker->Retire();
+}
+
+bool MySQLConnection::IsRetiring() const
+{
+    return m_worker && m_worker->IsRetiring();
+}
+
+bool MySQLConnection::IsRetired() const
+{
+    return m_worker && m_worker->IsRetired();
 }
 
 uint32_t MySQLConnection::GetLastError()
@@ -467,6 +533,44 @@ void MySQLConnection::PrepareStatement(uint32_t index, const char *sql, Connecti
     }
 }
 
+void MySQLConnection::PrepareBatchStatement(uint32_t index, const char *head, const char *row, const char *tail, ConnectionFlags flags)
+{
+    std::string sql = head;
+    for (uint32_t i = 0; i < std::max(m_connectionInfo.batchSize, 1u); ++i) {
+        if (i != 0)
+            sql += ", ";
+        sql += row;
+    }
+    sql += tail;
+
+    PrepareStatement(index, sql.c_str(), flags);
+}
+
+void MySQLConnection::PrepareKeyedUpdateStatement(uint32_t index, const char *table, const char *key, std::initializer_list<const char *> columns, const char *extra, ConnectionFlags flags)
+{
+    uint32_t const rows = std::max(m_connectionInfo.batchSize, 1u);
+    std::string sql = "UPDATE ";
+    sql += table;
+    sql += " SET ";
+    for (auto const *column : columns) {
+        sql += column;
+        sql += " = CASE ";
+        sql += key;
+        for (uint32_t i = 0; i < rows; ++i)
+            sql += " WHEN ? THEN ?";
+        sql += " END, ";
+    }
+    sql += extra;
+    sql += " WHERE ";
+    sql += key;
+    sql += " IN (";
+    for (uint32_t i = 0; i < rows; ++i)
+        sql += i != 0 ? ", ?" : "?";
+    sql += ")";
+
+    PrepareStatement(index, sql.c_str(), flags);
+}
+
 PreparedResultSet *MySQLConnection::Query(PreparedStatement *stmt)
 {
     MYSQL_RES *result = NULL;
@@ -15,6 +15,9 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -41,6 +44,8 @@ struct MySQLConnectionInfo {
     std::string database;
     std::string host;
     std::string port_or_socket;
+    uint32_t idlePingInterval{30 * 60}; //! Seconds a connection may stay unused before it is pinged
+    uint32_t batchSize{16}; //! Rows per multi row statement, see PrepareBatchStatement
 };
 
 typedef std::map<uint32_t /*index*/, std::pair<std::string /*query*/, ConnectionFlags /*sync/async*/>> PreparedStatementMap;
@@ -48,7 +53,7 @@ typedef std::map<uint32_t /*index*/, std::pair<std::string /*query*/, Connection
 class MySQLConnection {
     template<class T>
     friend class DatabaseWorkerPool;
-    friend class PingOperation;
+    friend class ResultStream;
 
 public:
     MySQLConnection(MySQLConnectionInfo &connInfo); //! Constructor for synchronous connections.
@@ -67,6 +72,8 @@ public:
     PreparedResultSet *Query(PreparedStatement *stmt);
     bool _Query(const char *sql, MYSQL_RES **pResult, MYSQL_FIELD **pFields, uint64_t *pRowCount, uint32_t *pFieldCount);
     bool _Query(PreparedStatement *stmt, MYSQL_RES **pResult, uint64_t *pRowCount, uint32_t *pFieldCount);
+    //! The stream unlocks this connection once it is destroyed
+    ResultStream *StreamQuery(const char *sql);
 
     void BeginTransaction();
     void RollbackTransaction();
@@ -74,9 +81,13 @@ public:
     int ExecuteTransaction(SQLTransaction &transaction);
 
     void Ping();
+    //! Pings the server when nothing ran on this connection for the idle ping interval
+    void PingIfIdle();
 
     uint32_t GetLastError();
 
+    char const *GetDatabaseName() const { return m_connectionInfo.database.c_str(); }
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
@@ -89,9 +100,22 @@ protected:
 
     MySQLPreparedStatement *GetPreparedStatement(uint32_t index);
     void PrepareStatement(uint32_t index, const char *sql, ConnectionFlags flags);
+    //! Prepares head + batchSize comma separated rows + tail, the statement BatchStatement merges rows into
+    void PrepareBatchStatement(uint32_t index, const char *head, const char *row, const char *tail, ConnectionFlags flags);
+    //! Prepares UPDATE table SET column = CASE key WHEN ? THEN ? ... END, ..., extra WHERE key IN (?, ...) for batchSize rows.
+    //! Only rows that exist are touched, the single row UPDATE takes the columns in the same order and the key last.
+    void PrepareKeyedUpdateStatement(uint32_t index, const char *table, const char *key, std::initializer_list<const char *> columns, const char *extra, ConnectionFlags flags);
 
     virtual void DoPrepareStatements() = 0;
 
+    //! Starts the worker of an asynchronous connection, once its statements are prepared
+    void StartWorker();
+    //! Lets the worker finish its current operation and leave, the pool shrinks this way
+    void RetireWorker();
+    bool IsRetiring() const;
+    bool IsRetired() const;
+    DatabaseWorker *GetWorker() const { return m_worker.get(); }
+
 protected:
     std::vector<std::unique_ptr<MySQLPreparedStatement>> m_stmts; //! PreparedStatements storage
     PreparedStatementMap m_queries; //! Query storage
@@ -100,6 +124,7 @@ protected:
 
 private:
     bool _HandleMySQLErrno(uint32_t errNo, uint8_t attempts = 5);
+    void _Touch() { m_lastUsed = std::chrono::steady_clock::now(); }
 
 private:
     ProducerConsumerQueue<SQLOperation *> *m_queue; //! Queue shared with other asynchronous connections.
@@ -108,6 +133,7 @@ private:
     MySQLConnectionInfo &m_connectionInfo; //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags; //! Connection flags (for preparing relevant statements)
     std::mutex m_Mutex;
+    std::atomic<std::chrono::steady_clock::time_point> m_lastUsed; //! Last statement sent to the server, pings included
 
     MySQLConnection(MySQLConnection const &right) = delete;
     MySQLConnection &operator=(MySQLConnection const &right) = delete;
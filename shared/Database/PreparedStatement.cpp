@@ -41,7 +41,7 @@ void PreparedStatement::BindParameters()
 {
     ASSERT(m_stmt);
 
-    uint8_t i = 0;
+    uint16_t i = 0;
     for (; i < statement_data.size(); i++) {
         switch (statement_data[i].type) {
         case TYPE_BOOL:
@@ -95,7 +95,7 @@ void PreparedStatement::BindParameters()
 }
 
 //- Bind to buffer
-void PreparedStatement::setBool(const uint8_t index, const bool value)
+void PreparedStatement::setBool(const uint16_t index, const bool value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -104,7 +104,7 @@ void PreparedStatement::setBool(const uint8_t index, const bool value)
     statement_data[index].type = TYPE_BOOL;
 }
 
-void PreparedStatement::setUInt8(const uint8_t index, const uint8_t value)
+void PreparedStatement::setUInt8(const uint16_t index, const uint8_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -113,7 +113,7 @@ void PreparedStatement::setUInt8(const uint8_t index, const uint8_t value)
     statement_data[index].type = TYPE_UI8;
 }
 
-void PreparedStatement::setUInt16(const uint8_t index, const uint16_t value)
+void PreparedStatement::setUInt16(const uint16_t index, const uint16_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -122,7 +122,7 @@ void PreparedStatement::setUInt16(const uint8_t index, const uint16_t value)
     statement_data[index].type = TYPE_UI16;
 }
 
-void PreparedStatement::setUInt32(const uint8_t index, const uint32_t value)
+void PreparedStatement::setUInt32(const uint16_t index, const uint32_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -131,7 +131,7 @@ void PreparedStatement::setUInt32(const uint8_t index, const uint32_t value)
     statement_data[index].type = TYPE_UI32;
 }
 
-void PreparedStatement::setUInt64(const uint8_t index, const uint64_t value)
+void PreparedStatement::setUInt64(const uint16_t index, const uint64_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -140,7 +140,7 @@ void PreparedStatement::setUInt64(const uint8_t index, const uint64_t value)
     statement_data[index].type = TYPE_UI64;
 }
 
-void PreparedStatement::setInt8(const uint8_t index, const int8_t value)
+void PreparedStatement::setInt8(const uint16_t index, const int8_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -149,7 +149,7 @@ void PreparedStatement::setInt8(const uint8_t index, const int8_t value)
     statement_data[index].type = TYPE_I8;
 }
 
-void PreparedStatement::setInt16(const uint8_t index, const int16_t value)
+void PreparedStatement::setInt16(const uint16_t index, const int16_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -158,7 +158,7 @@ void PreparedStatement::setInt16(const uint8_t index, const int16_t value)
     statement_data[index].type = TYPE_I16;
 }
 
-void PreparedStatement::setInt32(const uint8_t index, const int32_t value)
+void PreparedStatement::setInt32(const uint16_t index, const int32_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -167,7 +167,7 @@ void PreparedStatement::setInt32(const uint8_t index, const int32_t value)
     statement_data[index].type = TYPE_I32;
 }
 
-void PreparedStatement::setInt64(const uint8_t index, const int64_t value)
+void PreparedStatement::setInt64(const uint16_t index, const int64_t value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -176,7 +176,7 @@ void PreparedStatement::setInt64(const uint8_t index, const int64_t value)
     statement_data[index].type = TYPE_I64;
 }
 
-void PreparedStatement::setFloat(const uint8_t index, const float value)
+void PreparedStatement::setFloat(const uint16_t index, const float value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -185,7 +185,7 @@ void PreparedStatement::setFloat(const uint8_t index, const float value)
     statement_data[index].type = TYPE_FLOAT;
 }
 
-void PreparedStatement::setDouble(const uint8_t index, const double value)
+void PreparedStatement::setDouble(const uint16_t index, const double value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -194,7 +194,7 @@ void PreparedStatement::setDouble(const uint8_t index, const double value)
     statement_data[index].type = TYPE_DOUBLE;
 }
 
-void PreparedStatement::setString(const uint8_t index, const std::string &value)
+void PreparedStatement::setString(const uint16_t index, const std::string &value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -204,7 +204,7 @@ void PreparedStatement::setString(const uint8_t index, const std::string &value)
     statement_data[index].type = TYPE_STRING;
 }
 
-void PreparedStatement::setBinary(const uint8_t index, const std::vector<uint8_t> &value)
+void PreparedStatement::setBinary(const uint16_t index, const std::vector<uint8_t> &value)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -213,7 +213,7 @@ void PreparedStatement::setBinary(const uint8_t index, const std::vector<uint8_t
     statement_data[index].type = TYPE_BINARY;
 }
 
-void PreparedStatement::setNull(const uint8_t index)
+void PreparedStatement::setNull(const uint16_t index)
 {
     if (index >= statement_data.size())
         statement_data.resize(index + 1);
@@ -259,7 +259,7 @@ void MySQLPreparedStatement::ClearParameters()
     }
 }
 
-static bool ParamenterIndexAssertFail(uint32_t stmtIndex, uint8_t index, uint32_t paramCount)
+static bool ParamenterIndexAssertFail(uint32_t stmtIndex, uint16_t index, uint32_t paramCount)
 {
     NG_LOG_ERROR("sql.driver", "Attempted to bind parameter %u%s on a PreparedStatement %u (statement has only %u parameters)", uint32_t(index) + 1,
         (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
@@ -280,7 +280,7 @@ static void SetParameterValue(MYSQL_BIND *param, enum_field_types type, const vo
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::CheckValidIndex(uint8_t index)
+void MySQLPreparedStatement::CheckValidIndex(uint16_t index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->m_index, index, m_paramCount));
 
@@ -288,7 +288,7 @@ void MySQLPreparedStatement::CheckValidIndex(uint8_t index)
         NG_LOG_WARN("sql.sql", "[WARNING] Prepared Statement (id: %u) trying to bind value on already bound index (%u).", m_stmt->m_index, index);
 }
 
-void MySQLPreparedStatement::setNull(const uint8_t index)
+void MySQLPreparedStatement::setNull(const uint16_t index)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -302,12 +302,12 @@ void MySQLPreparedStatement::setNull(const uint8_t index)
     param->length = NULL;
 }
 
-void MySQLPreparedStatement::setBool(const uint8_t index, const bool value)
+void MySQLPreparedStatement::setBool(const uint16_t index, const bool value)
 {
     setUInt8(index, value ? 1 : 0);
 }
 
-void MySQLPreparedStatement::setUInt8(const uint8_t index, const uint8_t value)
+void MySQLPreparedStatement::setUInt8(const uint16_t index, const uint8_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -315,7 +315,7 @@ void MySQLPreparedStatement::setUInt8(const uint8_t index, const uint8_t value)
     SetParameterValue(param, MYSQL_TYPE_TINY, &value, sizeof(uint8_t), true);
 }
 
-void MySQLPreparedStatement::setUInt16(const uint8_t index, const uint16_t value)
+void MySQLPreparedStatement::setUInt16(const uint16_t index, const uint16_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -323,7 +323,7 @@ void MySQLPreparedStatement::setUInt16(const uint8_t index, const uint16_t value
     SetParameterValue(param, MYSQL_TYPE_SHORT, &value, sizeof(uint16_t), true);
 }
 
-void MySQLPreparedStatement::setUInt32(const uint8_t index, const uint32_t value)
+void MySQLPreparedStatement::setUInt32(const uint16_t index, const uint32_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -331,7 +331,7 @@ void MySQLPreparedStatement::setUInt32(const uint8_t index, const uint32_t value
     SetParameterValue(param, MYSQL_TYPE_LONG, &value, sizeof(uint32_t), true);
 }
 
-void MySQLPreparedStatement::setUInt64(const uint8_t index, const uint64_t value)
+void MySQLPreparedStatement::setUInt64(const uint16_t index, const uint64_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -339,7 +339,7 @@ void MySQLPreparedStatement::setUInt64(const uint8_t index, const uint64_t value
     SetParameterValue(param, MYSQL_TYPE_LONGLONG, &value, sizeof(uint64_t), true);
 }
 
-void MySQLPreparedStatement::setInt8(const uint8_t index, const int8_t value)
+void MySQLPreparedStatement::setInt8(const uint16_t index, const int8_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -347,7 +347,7 @@ void MySQLPreparedStatement::setInt8(const uint8_t index, const int8_t value)
     SetParameterValue(param, MYSQL_TYPE_TINY, &value, sizeof(int8_t), false);
 }
 
-void MySQLPreparedStatement::setInt16(const uint8_t index, const int16_t value)
+void MySQLPreparedStatement::setInt16(const uint16_t index, const int16_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -355,7 +355,7 @@ void MySQLPreparedStatement::setInt16(const uint8_t index, const int16_t value)
     SetParameterValue(param, MYSQL_TYPE_SHORT, &value, sizeof(int16_t), false);
 }
 
-void MySQLPreparedStatement::setInt32(const uint8_t index, const int32_t value)
+void MySQLPreparedStatement::setInt32(const uint16_t index, const int32_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -363,7 +363,7 @@ void MySQLPreparedStatement::setInt32(const uint8_t index, const int32_t value)
     SetParameterValue(param, MYSQL_TYPE_LONG, &value, sizeof(int32_t), false);
 }
 
-void MySQLPreparedStatement::setInt64(const uint8_t index, const int64_t value)
+void MySQLPreparedStatement::setInt64(const uint16_t index, const int64_t value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -371,7 +371,7 @@ void MySQLPreparedStatement::setInt64(const uint8_t index, const int64_t value)
     SetParameterValue(param, MYSQL_TYPE_LONGLONG, &value, sizeof(int64_t), false);
 }
 
-void MySQLPreparedStatement::setFloat(const uint8_t index, const float value)
+void MySQLPreparedStatement::setFloat(const uint16_t index, const float value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -379,7 +379,7 @@ void MySQLPreparedStatement::setFloat(const uint8_t index, const float value)
     SetParameterValue(param, MYSQL_TYPE_FLOAT, &value, sizeof(float), (value > 0.0f));
 }
 
-void MySQLPreparedStatement::setDouble(const uint8_t index, const double value)
+void MySQLPreparedStatement::setDouble(const uint16_t index, const double value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -387,7 +387,7 @@ void MySQLPreparedStatement::setDouble(const uint8_t index, const double value)
     SetParameterValue(param, MYSQL_TYPE_DOUBLE, &value, sizeof(double), (value > 0.0f));
 }
 
-void MySQLPreparedStatement::setBinary(const uint8_t index, const std::vector<uint8_t> &value, bool isString)
+void MySQLPreparedStatement::setBinary(const uint16_t index, const std::vector<uint8_t> &value, bool isString)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -54,6 +54,7 @@ class MySQLPreparedStatement;
 
 //- Upper-level class that is used in code
 class PreparedStatement {
+    friend class BatchStatement;
     friend class PreparedStatementTask;
     friend class MySQLPreparedStatement;
     friend class MySQLConnection;
@@ -62,20 +63,20 @@ public:
     explicit PreparedStatement(uint32_t index);
     ~PreparedStatement();
 
-    void setBool(const uint8_t index, const bool value);
-    void setUInt8(const uint8_t index, const uint8_t value);
-    void setUInt16(const uint8_t index, const uint16_t value);
-    void setUInt32(const uint8_t index, const uint32_t value);
-    void setUInt64(const uint8_t index, const uint64_t value);
-    void setInt8(const uint8_t index, const int8_t value);
-    void setInt16(const uint8_t index, const int16_t value);
-    void setInt32(const uint8_t index, const int32_t value);
-    void setInt64(const uint8_t index, const int64_t value);
-    void setFloat(const uint8_t index, const float value);
-    void setDouble(const uint8_t index, const double value);
-    void setString(const uint8_t index, const std::string &value);
-    void setBinary(const uint8_t index, const std::vector<uint8_t> &value);
-    void setNull(const uint8_t index);
+    void setBool(const uint16_t index, const bool value);
+    void setUInt8(const uint16_t index, const uint8_t value);
+    void setUInt16(const uint16_t index, const uint16_t value);
+    void setUInt32(const uint16_t index, const uint32_t value);
+    void setUInt64(const uint16_t index, const uint64_t value);
+    void setInt8(const uint16_t index, const int8_t value);
+    void setInt16(const uint16_t index, const int16_t value);
+    void setInt32(const uint16_t index, const int32_t value);
+    void setInt64(const uint16_t index, const int64_t value);
+    void setFloat(const uint16_t index, const float value);
+    void setDouble(const uint16_t index, const double value);
+    void setString(const uint16_t index, const std::string &value);
+    void setBinary(const uint16_t index, const std::vector<uint8_t> &value);
+    void setNull(const uint16_t index);
 
 protected:
     void BindParameters();
@@ -100,19 +101,19 @@ public:
     MySQLPreparedStatement(MYSQL_STMT *stmt);
     ~MySQLPreparedStatement();
 
-    void setNull(const uint8_t index);
-    void setBool(const uint8_t index, const bool value);
-    void setUInt8(const uint8_t index, const uint8_t value);
-    void setUInt16(const uint8_t index, const uint16_t value);
-    void setUInt32(const uint8_t index, const uint32_t value);
-    void setUInt64(const uint8_t index, const uint64_t value);
-    void setInt8(const uint8_t index, const int8_t value);
-    void setInt16(const uint8_t index, const int16_t value);
-    void setInt32(const uint8_t index, const int32_t value);
-    void setInt64(const uint8_t index, const int64_t value);
-    void setFloat(const uint8_t index, const float value);
-    void setDouble(const uint8_t index, const double value);
-    void setBinary(const uint8_t index, const std::vector<uint8_t> &value, bool isString);
+    void setNull(const uint16_t index);
+    void setBool(const uint16_t index, const bool value);
+    void setUInt8(const uint16_t index, const uint8_t value);
+    void setUInt16(const uint16_t index, const uint16_t value);
+    void setUInt32(const uint16_t index, const uint32_t value);
+    void setUInt64(const uint16_t index, const uint64_t value);
+    void setInt8(const uint16_t index, const int8_t value);
+    void setInt16(const uint16_t index, const int16_t value);
+    void setInt32(const uint16_t index, const int32_t value);
+    void setInt64(const uint16_t index, const int64_t value);
+    void setFloat(const uint16_t index, const float value);
+    void setDouble(const uint16_t index, const double value);
+    void setBinary(const uint16_t index, const std::vector<uint8_t> &value, bool isString);
 
 protected:
     MYSQL_STMT *GetSTMT() { return m_Mstmt; }
@@ -121,7 +122,7 @@ protected:
 
     PreparedStatement *m_stmt;
     void ClearParameters();
-    void CheckValidIndex(uint8_t index);
+    void CheckValidIndex(uint16_t index);
     std::string getQueryString(std::string const &sqlPattern) const;
 
 private:
@@ -20,6 +20,7 @@
 #include <algorithm>
 
 #include "QueryCallback.h"
+#include "Transaction.h"
 
 QueryCallbackProcessor::QueryCallbackProcessor() {}
 
@@ -30,8 +31,20 @@ void QueryCallbackProcessor::AddQuery(QueryCallback &&query)
     _callbacks.emplace_back(std::move(query));
 }
 
+void QueryCallbackProcessor::AddTransaction(TransactionCallback &&transaction)
+{
+    _transactions.emplace_back(std::move(transaction));
+}
+
 void QueryCallbackProcessor::ProcessReadyQueries()
 {
+    if (!_transactions.empty()) {
+        std::vector<TransactionCallback> updateTransactions{std::move(_transactions)};
+        updateTransactions.erase(
+            std::remove_if(updateTransactions.begin(), updateTransactions.end(), [](TransactionCallback &callback) { return callback.InvokeIfReady(); }), updateTransactions.end());
+        _transactions.insert(_transactions.end(), std::make_move_iterator(updateTransactions.begin()), std::make_move_iterator(updateTransactions.end()));
+    }
+
     if (_callbacks.empty())
         return;
 
@@ -20,6 +20,7 @@
 #include "Define.h"
 
 class QueryCallback;
+class TransactionCallback;
 
 class QueryCallbackProcessor {
 public:
@@ -27,6 +28,7 @@ public:
     ~QueryCallbackProcessor();
 
     void AddQuery(QueryCallback &&query);
+    void AddTransaction(TransactionCallback &&transaction);
     void ProcessReadyQueries();
 
 private:
@@ -34,4 +36,5 @@ private:
     QueryCallbackProcessor &operator=(QueryCallbackProcessor const &) = delete;
 
     std::vector<QueryCallback> _callbacks;
+    std::vector<TransactionCallback> _transactions;
 };
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include "Errors.h"
 #include "Field.h"
 #include "Log.h"
+#include "MySQLConnection.h"
 
 #ifdef _WIN32 // hack for broken mysql.h not including the correct winsock header for SOCKET definition, fixed in 5.7
 #include <winsock2.h>
@@ -307,6 +308,40 @@ bool PreparedResultSet::_NextRow()
     return retval == 0 || retval == MYSQL_DATA_TRUNCATED;
 }
 
+ResultStream::ResultStream(MySQLConnection *connection, MYSQL_RES *result, uint32_t fieldCount)
+    : _connection(connection)
+    , _result(result)
+    , _fieldCount(fieldCount)
+    , _rowPosition(0)
+    , _row(NULL)
+    , _lengths(NULL)
+{
+}
+
+ResultStream::~ResultStream()
+{
+    //! Reads and drops whatever the caller left, the connection is unusable before that
+    mysql_free_result(_result);
+    _connection->Unlock();
+}
+
+bool ResultStream::NextRow()
+{
+    if (!_result)
+        return false;
+
+    _row = mysql_fetch_row(_result);
+    if (!_row) {
+        if (uint32_t lErrno = mysql_errno(_result->handle))
+            NG_LOG_ERROR("sql.sql", "%s: stream broke after " UI64FMTD " rows. Error [%u] %s.", __FUNCTION__, _rowPosition, lErrno, mysql_error(_result->handle));
+        return false;
+    }
+
+    _lengths = mysql_fetch_lengths(_result);
+    ++_rowPosition;
+    return true;
+}
+
 void ResultSet::CleanUp()
 {
     if (_currentRow) {
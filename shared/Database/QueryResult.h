@@ -21,6 +21,8 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 
+class MySQLConnection;
+
 class ResultSet {
 public:
     ResultSet(MYSQL_RES *result, MYSQL_FIELD *fields, uint64_t rowCount, uint32_t fieldCount);
@@ -50,6 +52,37 @@ private:
     ResultSet &operator=(ResultSet const &right) = delete;
 };
 
+/*! Unbuffered result of an ad hoc query, rows are fetched from the server one at a time.
+    Holds the synchronous connection it was read from until it is destroyed, the
+    connection cannot run anything else before every row was fetched. */
+class ResultStream {
+public:
+    ResultStream(MySQLConnection *connection, MYSQL_RES *result, uint32_t fieldCount);
+    ~ResultStream();
+
+    bool NextRow();
+
+    uint32_t GetFieldCount() const { return _fieldCount; }
+
+    uint64_t GetRowPosition() const { return _rowPosition; }
+
+    //! Text values of the current row, NULL for SQL NULL
+    char **GetValues() const { return _row; }
+
+    unsigned long *GetLengths() const { return _lengths; }
+
+private:
+    MySQLConnection *_connection;
+    MYSQL_RES *_result;
+    uint32_t _fieldCount;
+    uint64_t _rowPosition;
+    char **_row;
+    unsigned long *_lengths;
+
+    ResultStream(ResultStream const &right) = delete;
+    ResultStream &operator=(ResultStream const &right) = delete;
+};
+
 class PreparedResultSet {
 public:
     PreparedResultSet(MYSQL_STMT *stmt, MYSQL_RES *result, uint64_t rowCount, uint32_t fieldCount);
@@ -0,0 +1,153 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Log.h"
+#include "QueryResult.h"
+
+namespace RowReaderDetail {
+    //! Converts one text protocol value, SQL NULL becomes zero or an empty string
+    template<class T>
+    void Convert(T &out, char const *value, unsigned long length)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (value)
+                out.assign(value, length);
+            else
+                out.clear();
+        }
+        else if constexpr (std::is_enum_v<T>) {
+            std::underlying_type_t<T> underlying;
+            Convert(underlying, value, length);
+            out = static_cast<T>(underlying);
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            out = value && strtoll(value, nullptr, 10) != 0;
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            out = value ? static_cast<T>(strtod(value, nullptr)) : T{};
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            out = value ? static_cast<T>(strtoll(value, nullptr, 10)) : T{};
+        }
+        else {
+            static_assert(std::is_unsigned_v<T>, "RowBinding: unsupported column type");
+            out = value ? static_cast<T>(strtoull(value, nullptr, 10)) : T{};
+        }
+    }
+} // namespace RowReaderDetail
+
+/*! Maps the columns of a query onto the members of Row, in select order.
+    Build it once per table (a function local static) and hand it to every RowReader:
+
+        static RowBinding<CreatureStat> const binding =
+            RowBinding<CreatureStat>().Column(&CreatureStat::stat_id).Column(&CreatureStat::strength);
+
+    An array member takes one column per element, nested arrays row by row. */
+template<class Row>
+class RowBinding {
+public:
+    //! Members Row inherits bind as well, a loader can add scratch columns by deriving from the template it fills
+    template<class M, class Owner>
+    RowBinding &Column(M Owner::*member)
+    {
+        static_assert(std::is_base_of_v<Owner, Row>, "RowBinding: member does not belong to Row");
+        return Element([member](Row &row) -> M & { return row.*member; });
+    }
+
+    //! Binds whatever accessor returns a reference to, for elements of interleaved arrays
+    template<class Accessor>
+    RowBinding &Element(Accessor accessor)
+    {
+        using T = std::remove_reference_t<std::invoke_result_t<Accessor, Row &>>;
+        if constexpr (std::is_array_v<T>) {
+            for (std::size_t i = 0; i < std::extent_v<T>; ++i)
+                Element([accessor, i](Row &row) -> auto & { return accessor(row)[i]; });
+        }
+        else {
+            _columns.emplace_back([accessor](Row &row, char const *value, unsigned long length) { RowReaderDetail::Convert(accessor(row), value, length); });
+        }
+        return *this;
+    }
+
+    //! Columns that are selected but not needed
+    RowBinding &Skip(uint32_t count = 1)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            _columns.emplace_back(nullptr);
+        return *this;
+    }
+
+    uint32_t GetColumnCount() const { return static_cast<uint32_t>(_columns.size()); }
+
+    void Read(Row &row, char **values, unsigned long *lengths) const
+    {
+        for (std::size_t i = 0; i < _columns.size(); ++i) {
+            if (_columns[i])
+                _columns[i](row, values[i], lengths[i]);
+        }
+    }
+
+private:
+    std::vector<std::function<void(Row &, char const *, unsigned long)>> _columns;
+};
+
+/*! Reads a QueryResultStream into Row one row at a time, nothing but the current row is held in memory.
+    The stream keeps its connection busy, do not query the same database before the reader is gone. */
+template<class Row>
+class RowReader {
+public:
+    RowReader(QueryResultStream stream, RowBinding<Row> const &binding)
+        : _stream(std::move(stream))
+        , _binding(binding)
+    {
+        if (_stream && _stream->GetFieldCount() < _binding.GetColumnCount()) {
+            NG_LOG_ERROR("sql.sql", "RowReader: query returns %u columns but %u are bound, nothing is read.", _stream->GetFieldCount(), _binding.GetColumnCount());
+            _stream.reset();
+        }
+    }
+
+    //! Overwrites every bound member of row, false once the stream is exhausted or failed
+    bool Next(Row &row)
+    {
+        if (!_stream)
+            return false;
+
+        if (!_stream->NextRow()) {
+            //! Hand the connection back as soon as possible
+            _stream.reset();
+            return false;
+        }
+
+        _binding.Read(row, _stream->GetValues(), _stream->GetLengths());
+        return true;
+    }
+
+private:
+    QueryResultStream _stream;
+    RowBinding<Row> const &_binding;
+
+    RowReader(RowReader const &right) = delete;
+    RowReader &operator=(RowReader const &right) = delete;
+};
@@ -15,6 +15,10 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 
@@ -41,6 +45,34 @@ union SQLResultSetUnion {
 
 class MySQLConnection;
 
+//! Counts the bulk operations of each order key that are queued or still running, see DatabaseWorkerPool::OrderScope
+class SQLOrderTracker {
+public:
+    void Add(uint32_t key)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++_pending[key];
+    }
+
+    void Done(uint32_t key)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto itr = _pending.find(key);
+        if (itr != _pending.end() && --itr->second == 0)
+            _pending.erase(itr);
+    }
+
+    bool IsPending(uint32_t key)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        return _pending.count(key) != 0;
+    }
+
+private:
+    std::mutex _lock;
+    std::unordered_map<uint32_t, uint32_t> _pending;
+};
+
 class SQLOperation {
 public:
     SQLOperation()
@@ -61,6 +93,11 @@ public:
     virtual void SetConnection(MySQLConnection *con) { m_conn = con; }
 
     MySQLConnection *m_conn;
+    //! Set when the operation is handed to the async queue, used for the latency metrics
+    std::chrono::steady_clock::time_point m_tQueued;
+    //! Set for bulk operations enqueued under an order key, told when the operation is done
+    SQLOrderTracker *m_pOrder{nullptr};
+    uint32_t m_nOrderKey{0};
 
 private:
     SQLOperation(SQLOperation const &right) = delete;
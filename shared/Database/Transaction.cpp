@@ -83,3 +83,21 @@ bool TransactionTask::Execute()
 
     return false;
 }
+
+bool TransactionWithResultTask::Execute()
+{
+    bool bCommitted = TransactionTask::Execute();
+    m_result.set_value(bCommitted);
+    return bCommitted;
+}
+
+bool TransactionCallback::InvokeIfReady()
+{
+    if (m_future.valid() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        bool bCommitted = m_future.get();
+        if (m_callback)
+            m_callback(bCommitted);
+        return true;
+    }
+    return false;
+}
@@ -15,6 +15,7 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <functional>
 #include <mutex>
 #include <vector>
 
@@ -77,4 +78,47 @@ protected:
 
     SQLTransaction m_trans;
     static std::mutex _deadlockLock;
+};
+
+/*! Transaction task that reports whether it was committed*/
+class TransactionWithResultTask : public TransactionTask {
+public:
+    TransactionWithResultTask(SQLTransaction trans)
+        : TransactionTask(trans)
+    {
+    }
+
+    TransactionFuture GetFuture() { return m_result.get_future(); }
+
+protected:
+    bool Execute() override;
+
+    TransactionPromise m_result;
+};
+
+/*! Runs a callback with the outcome of an asynchronously committed transaction, see QueryCallbackProcessor*/
+class TransactionCallback {
+public:
+    explicit TransactionCallback(TransactionFuture &&future)
+        : m_future(std::move(future))
+    {
+    }
+    TransactionCallback(TransactionCallback &&) = default;
+    TransactionCallback &operator=(TransactionCallback &&) = default;
+
+    TransactionCallback &&AfterComplete(std::function<void(bool)> &&callback)
+    {
+        m_callback = std::move(callback);
+        return std::move(*this);
+    }
+
+    //! true once the callback ran
+    bool InvokeIfReady();
+
+private:
+    TransactionCallback(TransactionCallback const &) = delete;
+    TransactionCallback &operator=(TransactionCallback const &) = delete;
+
+    TransactionFuture m_future;
+    std::function<void(bool)> m_callback;
 };
\ No newline at end of file
@@ -31,6 +31,12 @@ public:
         return (itr != GetContainer().end()) ? itr->second : nullptr;
     }
 
+    static size_t Size()
+    {
+        NG_SHARED_GUARD readGuard(*GetLock());
+        return GetContainer().size();
+    }
+
     static auto GetContainer() -> MapType &
     {
         static MapType m_objectMap;
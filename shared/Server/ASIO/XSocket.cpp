@@ -1,12 +1,40 @@
 #include "XSocket.h"
 
+#include <algorithm>
+
+#include "Metrics.h"
+
+namespace {
+    /// Packets handed to SendPacket that no socket has written out yet, summed over all sockets
+    NGemity::Metrics::Gauge &sendQueueDepth()
+    {
+        static auto &gauge = sMetrics.GetGauge("network.send_queue");
+        return gauge;
+    }
+} // namespace
+
+std::atomic<uint32_t> XSocket::_flushEpoch{0};
+
 XSocket::XSocket(boost::asio::ip::tcp::socket &&socket)
     : Socket(std::move(socket))
     , _sendBufferSize(4096)
+    , _packetVersion(sConfigMgr->getCachedConfig().packetVersion)
+    , _batchSends(false)
+    , _flushedEpoch(0)
+    , _urgentQueued(false)
 {
     _headerBuffer.Resize(HEADER_SIZE);
 }
 
+XSocket::~XSocket()
+{
+    EncryptablePacket *queued;
+    while (_bufferQueue.Dequeue(queued)) {
+        sendQueueDepth().Add(-1);
+        delete queued;
+    }
+}
+
 void XSocket::Start()
 {
     if (IsEncrypted()) {
@@ -20,16 +48,31 @@ void XSocket::Start()
 
 bool XSocket::Update()
 {
+    if (_batchSends) {
+        // Nothing is written before the world tick ended, unless someone waits for an urgent packet
+        uint32_t epoch = _flushEpoch.load(std::memory_order_acquire);
+        if (epoch == _flushedEpoch && !_urgentQueued.exchange(false))
+            return BaseSocket::Update();
+        _flushedEpoch = epoch;
+    }
+
     EncryptablePacket *queued;
     MessageBuffer buffer(_sendBufferSize);
     while (_bufferQueue.Dequeue(queued)) {
+        sendQueueDepth().Add(-1);
         auto packetSize = queued->size();
-        queued->FinalizePacket();
+        if (!queued->IsFinalized())
+            queued->FinalizePacket();
         if (queued->NeedsEncryption()) {
             _encryption.Encode((char *)queued->contents(), (char *)queued->contents(), packetSize);
         }
 
-        if (buffer.GetRemainingSpace() < packetSize) {
+        if (_batchSends) {
+            // Keep the whole batch contiguous, it is handed to the socket in one write
+            if (buffer.GetRemainingSpace() < packetSize + HEADER_SIZE)
+                buffer.Resize(buffer.GetBufferSize() + std::max(_sendBufferSize, packetSize + HEADER_SIZE));
+        }
+        else if (buffer.GetRemainingSpace() < packetSize) {
             QueuePacket(std::move(buffer));
             buffer.Resize(_sendBufferSize);
         }
@@ -57,7 +100,19 @@ void XSocket::SendPacket(XPacket const &packet)
     if (!IsOpen())
         return;
 
+    sendQueueDepth().Add(1);
     _bufferQueue.Enqueue(new EncryptablePacket(packet, IsEncrypted()));
+    if (_batchSends && IsUrgentPacket(packet.GetPacketID()))
+        _urgentQueued = true;
+}
+
+void XSocket::SendPacketBatch(XPacket const &packets)
+{
+    if (!IsOpen() || packets.empty())
+        return;
+
+    sendQueueDepth().Add(1);
+    _bufferQueue.Enqueue(new EncryptablePacket(packets, IsEncrypted(), true));
 }
 
 void XSocket::SetSendBufferSize(std::size_t sendBufferSize)
@@ -17,6 +17,7 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <mutex>
@@ -32,15 +33,18 @@
 
 class EncryptablePacket : public XPacket {
 public:
-    EncryptablePacket(XPacket const &packet, bool encrypt)
+    EncryptablePacket(XPacket const &packet, bool encrypt, bool finalized = false)
         : XPacket(packet)
         , _encrypt(encrypt)
+        , _finalized(finalized)
     {
     }
     bool NeedsEncryption() const { return _encrypt; }
+    bool IsFinalized() const { return _finalized; }
 
 private:
     bool _encrypt;
+    bool _finalized; // headers already written, may hold several packets
 };
 
 constexpr int HEADER_SIZE = sizeof(TS_MESSAGE);
@@ -55,7 +59,7 @@ public:
     // Overrides
     virtual ReadDataHandlerResult ProcessIncoming(XPacket *) { return ReadDataHandlerResult::Error; };
     virtual bool IsEncrypted() const { return true; }
-    virtual ~XSocket() = default;
+    virtual ~XSocket();
 
     void Start() override;
     bool Update() override;
@@ -69,18 +73,28 @@ public:
         XPacket output;
         // Log packet
         if(sConfigMgr->GetBoolDefault("Network.LogPackets", false)) {
-            JSONWriter jsonWriter(sConfigMgr->getCachedConfig().packetVersion, true);
+            JSONWriter jsonWriter(_packetVersion, true);
             packet.serialize(&jsonWriter);
             jsonWriter.finalize();
             NG_LOG_DEBUG("network.packets", "Sending packet: %s", jsonWriter.toString().c_str());
         }
-        MessageSerializerBuffer serializer(&output);
-        packet.serialize(&serializer);
-        SendPacket(*serializer.getFinalizedPacket());
+        SerializePacket(packet, &output, _packetVersion);
+        SendPacket(output);
     }
 
+    /// \brief Queues packets that are serialized and finalized already, back to back in one buffer
+    void SendPacketBatch(XPacket const &packets);
+
     void SetSendBufferSize(std::size_t sendBufferSize);
 
+    /// \brief Holds the packets of this socket back until FlushSendBatches is called
+    /// Everything sent in between goes out as one write, urgent packets flush right away.
+    void SetBatchedSend(bool batched) { _batchSends = batched; }
+
+    /// \brief Lets every batched socket write out its packets with its next network update
+    /// Called by the world thread at the end of each tick.
+    static void FlushSendBatches() { _flushEpoch.fetch_add(1, std::memory_order_release); }
+
 protected:
     void ReadHandler() override;
     bool ReadHeaderHandler();
@@ -88,6 +102,9 @@ protected:
 
     virtual void InitSocket() {}
 
+    /// Packets the client waits for, those are not held back by SetBatchedSend
+    virtual bool IsUrgentPacket(uint16_t /*packetId*/) const { return false; }
+
 private:
     void WritePacketToBuffer(EncryptablePacket const &packet, MessageBuffer &buffer);
     void SendPacket(XPacket const &packet);
@@ -98,4 +115,10 @@ private:
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
     std::size_t _sendBufferSize;
+
+    int _packetVersion; // client version of this connection, fixed when it is opened
+    bool _batchSends;
+    uint32_t _flushedEpoch;
+    std::atomic<bool> _urgentQueued;
+    static std::atomic<uint32_t> _flushEpoch;
 };
@@ -10,6 +10,12 @@ MessageSerializerBuffer::MessageSerializerBuffer(XPacket *packet)
 {
 }
 
+MessageSerializerBuffer::MessageSerializerBuffer(XPacket *packet, int version)
+    : StructSerializer(version)
+    , packet(packet)
+{
+}
+
 MessageSerializerBuffer::~MessageSerializerBuffer() {}
 
 void MessageSerializerBuffer::writeString(const char *fieldName, const std::string &val, size_t maxSize)
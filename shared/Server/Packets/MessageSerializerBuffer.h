@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "PacketEpics.h"
 #include "StructSerializer.h"
 #include "XPacket.h"
 
@@ -14,6 +15,7 @@ private:
 
 public:
     MessageSerializerBuffer(XPacket *packet);
+    MessageSerializerBuffer(XPacket *packet, int version);
     ~MessageSerializerBuffer();
 
     const XPacket *getPacket() const { return packet; }
@@ -242,4 +244,77 @@ public:
     }
 };
 
+/// \brief MessageSerializerBuffer bound to one client version at compile time
+/// getVersion returns a std::integral_constant, so every version condition of the generated
+/// serialize and getSize functions is a constant and packets without dynamic fields get a
+/// constant size. Nested objects are serialized through this buffer as well.
+template<int Version>
+class VersionedSerializerBuffer : public MessageSerializerBuffer {
+public:
+    explicit VersionedSerializerBuffer(XPacket *packet)
+        : MessageSerializerBuffer(packet, Version)
+    {
+    }
+
+    static constexpr std::integral_constant<int, Version> getVersion() { return {}; }
+
+    using MessageSerializerBuffer::write;
+    using MessageSerializerBuffer::writeArray;
+    using MessageSerializerBuffer::writeDynArray;
+
+    // Objects
+    template<typename T>
+    typename std::enable_if<!is_primitive<T>::value, void>::type write(const char *fieldName, const T &val)
+    {
+        (void)fieldName;
+        val.serialize(this);
+    }
+
+    // Fixed array of object
+    template<typename T>
+    typename std::enable_if<!is_primitive<T>::value, void>::type writeArray(const char *fieldName, const T *val, size_t size)
+    {
+        for (size_t i = 0; i < size; i++) {
+            write<T>(fieldName, val[i]);
+        }
+    }
+
+    // Dynamic array of object
+    template<typename T>
+    typename std::enable_if<!is_primitive<T>::value, void>::type writeDynArray(const char *fieldName, const std::vector<T> &val, uint32_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            write<T>(fieldName, val[i]);
+    }
+};
+
+// Client versions the send path is specialized for, the others go through the runtime version checks
+#define NG_SPECIALIZED_PACKET_VERSIONS(F) \
+    F(EPIC_4_1_1)                         \
+    F(EPIC_LATEST)
+
+/// \brief Serializes packet into output for the given client version
+/// The version is switched on once per packet instead of once per field.
+template<class TS_SERIALIZABLE_PACKET>
+void SerializePacket(const TS_SERIALIZABLE_PACKET &packet, XPacket *output, int version)
+{
+#define NG_SERIALIZE_FOR_VERSION(version_)                           \
+    case version_: {                                                 \
+        VersionedSerializerBuffer<version_> serializer(output);      \
+        packet.serialize(&serializer);                               \
+        serializer.getFinalizedPacket();                             \
+        return;                                                      \
+    }
+
+    switch (version) {
+        NG_SPECIALIZED_PACKET_VERSIONS(NG_SERIALIZE_FOR_VERSION)
+    default: {
+        MessageSerializerBuffer serializer(output, version);
+        packet.serialize(&serializer);
+        serializer.getFinalizedPacket();
+    }
+    }
+#undef NG_SERIALIZE_FOR_VERSION
+}
+
 #endif // MESSAGEBUFFER_H
@@ -61,24 +61,42 @@ namespace PacketDeclaration {
     }
 
     /**
-     * @brief Return the size of an object given the version.
-     * This calls the getSize function of the object.
-     * The object need to be declared with CREATE_STRUCT / CREATE_PACKET or the likes.
+     * @brief Return the serialized size of a field given the version.
+     * T is the declared type of the field, the value is not copied to it.
+     * The version is either an int or a std::integral_constant when the serializer is specialized
+     * for one client version, so version conditions of nested objects fold away as well.
      */
-    template<class T>
-    inline typename std::enable_if<!std::is_fundamental<T>::value && !std::is_enum<T>::value, int>::type getSizeOf(const T &value, int version)
+    template<typename T, typename U, typename Version>
+    inline uint32_t getSizeOf(const U &value, Version version)
     {
-        return value.getSize(version);
+        if constexpr (std::is_fundamental<T>::value || std::is_enum<T>::value) {
+            (void)value;
+            (void)version;
+            return sizeof(T);
+        }
+        else {
+            return static_cast<const T &>(value).getSize(version);
+        }
     }
 
     /**
-     * @brief Return the size of an basic type or enum.
+     * @brief Return the serialized size of the first count elements of a fixed or dynamic array.
+     * Arrays of basic types or enums are a constant size per element.
      */
-    template<typename T>
-    inline typename std::enable_if<std::is_fundamental<T>::value || std::is_enum<T>::value, int>::type getSizeOf(const T &value, int version)
+    template<typename T, typename U, typename Version>
+    inline uint32_t getArraySizeOf(const U &values, size_t count, Version version)
     {
-        (void)version;
-        return sizeof(value);
+        if constexpr (std::is_fundamental<T>::value || std::is_enum<T>::value) {
+            (void)values;
+            (void)version;
+            return static_cast<uint32_t>(count * sizeof(T));
+        }
+        else {
+            uint32_t size = 0;
+            for (size_t i = 0; i < count; ++i)
+                size += getSizeOf<T>(values[i], version);
+            return size;
+        }
     }
 
     /**
@@ -205,37 +223,31 @@ namespace PacketDeclaration {
 #define SIZE_F_endstring(...) OVERLOADED_CALL(SIZE_F_ENDSTRING, __VA_ARGS__)
 #define SIZE_F_endarray(...) OVERLOADED_CALL(SIZE_F_ENDARRAY, __VA_ARGS__)
 
-#define SIZE_F_SIMPLE2(type, name) size += PacketDeclaration::getSizeOf((type)name, version);
+#define SIZE_F_SIMPLE2(type, name) size += PacketDeclaration::getSizeOf<type>(name, version);
 #define SIZE_F_SIMPLE3(type, name, cond) \
     if (cond)                            \
-        size += PacketDeclaration::getSizeOf((type)name, version);
+        size += PacketDeclaration::getSizeOf<type>(name, version);
 #define SIZE_F_SIMPLE4(type, name, cond, defaultval) \
     if (cond)                                        \
-        size += PacketDeclaration::getSizeOf((type)name, version);
+        size += PacketDeclaration::getSizeOf<type>(name, version);
 
 #define SIZE_F_ARRAY3(type, name, _size) \
-    for (int i = 0; i < _size; ++i)      \
-        size += PacketDeclaration::getSizeOf((type)name[i], version);
+    size += PacketDeclaration::getArraySizeOf<type>(name, _size, version);
 #define SIZE_F_ARRAY4(type, name, _size, cond) \
     if (cond)                                  \
-        for (int i = 0; i < _size; ++i)        \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, _size, version);
 #define SIZE_F_ARRAY5(type, name, _size, cond, defaultval) \
     if (cond)                                              \
-        for (int i = 0; i < _size; ++i)                    \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, _size, version);
 
 #define SIZE_F_DYNARRAY2(type, name)         \
-    for (size_t i = 0; i < name##_size; i++) \
-        size += PacketDeclaration::getSizeOf((type)name[i], version);
+    size += PacketDeclaration::getArraySizeOf<type>(name, name##_size, version);
 #define SIZE_F_DYNARRAY3(type, name, cond)       \
     if (cond)                                    \
-        for (size_t i = 0; i < name##_size; i++) \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, name##_size, version);
 #define SIZE_F_DYNARRAY4(type, name, cond, defaultval) \
     if (cond)                                          \
-        for (size_t i = 0; i < name##_size; i++)       \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, name##_size, version);
 
 #define SIZE_F_COUNT2(type, ref)                                                                            \
     ref##_size = PacketDeclaration::getClampedCount<type>(ref.size() + _metadata_##ref::addNullTerminator); \
@@ -287,16 +299,13 @@ namespace PacketDeclaration {
         size += (uint32_t)name.size();
 
 #define SIZE_F_ENDARRAY2(type, name)         \
-    for (size_t i = 0; i < name.size(); i++) \
-        size += PacketDeclaration::getSizeOf((type)name[i], version);
+    size += PacketDeclaration::getArraySizeOf<type>(name, name.size(), version);
 #define SIZE_F_ENDARRAY3(type, name, cond)       \
     if (cond)                                    \
-        for (size_t i = 0; i < name.size(); i++) \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, name.size(), version);
 #define SIZE_F_ENDARRAY4(type, name, cond, defaultval) \
     if (cond)                                          \
-        for (size_t i = 0; i < name.size(); i++)       \
-            size += PacketDeclaration::getSizeOf((type)name[i], version);
+        size += PacketDeclaration::getArraySizeOf<type>(name, name.size(), version);
 
 // Serialization function
 #define SERIALIZATION_F_simple(...) OVERLOADED_CALL(SERIALIZATION_F_SIMPLE, __VA_ARGS__)
@@ -526,7 +535,8 @@ namespace PacketDeclaration {
         {                                                                                                         \
             return receivedId;                                                                                    \
         };                                                                                                        \
-        uint32_t getSize(int version) const                                                                       \
+        template<typename Version>                                                                                \
+        uint32_t getSize(Version version) const                                                                   \
         {                                                                                                         \
             uint32_t size = size_base_;                                                                           \
             (void)(version);                                                                                      \
@@ -537,7 +547,7 @@ namespace PacketDeclaration {
         template<class T>                                                                                         \
         void serialize(T *buffer) const                                                                           \
         {                                                                                                         \
-            const int version = buffer->getVersion();                                                             \
+            const auto version = buffer->getVersion();                                                            \
             (void)(version);                                                                                      \
             serialization_header_;                                                                                \
             name_##_DEF(LOCAL_DEFINITION_F);                                                                      \
@@ -546,7 +556,7 @@ namespace PacketDeclaration {
         template<class T>                                                                                         \
         void deserialize(T *buffer)                                                                               \
         {                                                                                                         \
-            const int version = buffer->getVersion();                                                             \
+            const auto version = buffer->getVersion();                                                            \
             (void)(version);                                                                                      \
             deserialization_header_;                                                                              \
             name_##_DEF(LOCAL_DEFINITION_F);                                                                      \
@@ -15,6 +15,7 @@
  * You should have received a copy of the GNU General Public License along
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -27,6 +28,7 @@ class ProducerConsumerQueue
 private:
     mutable std::mutex _queueLock;
     std::queue<T> _queue;
+    std::queue<T> _priorityQueue; // always served before _queue
     std::condition_variable _condition;
     std::atomic<bool> _shutdown;
 
@@ -50,30 +52,37 @@ public:
         _condition.notify_one();
     }
 
+    //! Queues the value ahead of everything pushed through Push
+    void PushPriority(T const& value)
+    {
+        std::lock_guard<std::mutex> lock(_queueLock);
+        _priorityQueue.push(value);
+
+        _condition.notify_one();
+    }
+
     bool Empty() const
     {
         std::lock_guard<std::mutex> lock(_queueLock);
 
-        return _queue.empty();
+        return _queue.empty() && _priorityQueue.empty();
     }
 
     size_t Size() const
     {
         std::lock_guard<std::mutex> lock(_queueLock);
 
-        return _queue.size();
+        return _queue.size() + _priorityQueue.size();
     }
 
     bool Pop(T& value)
     {
         std::lock_guard<std::mutex> lock(_queueLock);
 
-        if (_queue.empty() || _shutdown)
+        if (isEmpty() || _shutdown)
             return false;
 
-        value = std::move(_queue.front());
-
-        _queue.pop();
+        popFront(value);
 
         return true;
     }
@@ -84,33 +93,66 @@ public:
 
         // we could be using .wait(lock, predicate) overload here but it is broken
         // https://connect.microsoft.com/VisualStudio/feedback/details/1098841
-        while (_queue.empty() && !_shutdown)
+        while (isEmpty() && !_shutdown)
             _condition.wait(lock);
 
-        if (_queue.empty() || _shutdown)
+        if (isEmpty() || _shutdown)
             return;
 
-        value = _queue.front();
+        popFront(value);
+    }
+
+    //! Like WaitAndPop, but gives up after timeout
+    //! Returns false if nothing was popped
+    bool WaitAndPop(T& value, std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(_queueLock);
+
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (isEmpty() && !_shutdown)
+            if (_condition.wait_until(lock, deadline) == std::cv_status::timeout)
+                break;
+
+        if (isEmpty() || _shutdown)
+            return false;
+
+        popFront(value);
 
-        _queue.pop();
+        return true;
     }
 
+    bool IsCanceled() const { return _shutdown; }
+
     void Cancel()
     {
         std::unique_lock<std::mutex> lock(_queueLock);
 
-        while (!_queue.empty())
+        for (auto *queue : { &_priorityQueue, &_queue })
         {
-            T& value = _queue.front();
+            while (!queue->empty())
+            {
+                T& value = queue->front();
 
-            if constexpr (std::is_pointer_v<T>)
-                delete value;
+                if constexpr (std::is_pointer_v<T>)
+                    delete value;
 
-            _queue.pop();
+                queue->pop();
+            }
         }
 
         _shutdown = true;
 
         _condition.notify_all();
     }
+
+private:
+    // Both expect _queueLock to be held
+    bool isEmpty() const { return _queue.empty() && _priorityQueue.empty(); }
+
+    void popFront(T& value)
+    {
+        std::queue<T>& queue = !_priorityQueue.empty() ? _priorityQueue : _queue;
+        value = std::move(queue.front());
+        queue.pop();
+    }
 };
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Metrics.h"
+
+#include <bit>
+#include <cstdio>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include "Config.h"
+#include "Log.h"
+
+void NGemity::Metrics::Histogram::Observe(uint64_t nMicroseconds)
+{
+    auto nBucket = std::min(static_cast<int32_t>(std::bit_width(nMicroseconds)), BUCKET_COUNT - 1);
+    m_vBuckets[nBucket].fetch_add(1, std::memory_order_relaxed);
+    m_nCount.fetch_add(1, std::memory_order_relaxed);
+    m_nSum.fetch_add(nMicroseconds, std::memory_order_relaxed);
+
+    uint64_t nMax = m_nMax.load(std::memory_order_relaxed);
+    while (nMicroseconds > nMax && !m_nMax.compare_exchange_weak(nMax, nMicroseconds, std::memory_order_relaxed))
+        ;
+}
+
+uint64_t NGemity::Metrics::Histogram::Percentile(double fRatio) const
+{
+    uint64_t nCount = GetCount();
+    if (nCount == 0)
+        return 0;
+
+    auto nRank = static_cast<uint64_t>(fRatio * static_cast<double>(nCount - 1)) + 1;
+    uint64_t nSeen = 0;
+    for (int32_t i = 0; i < BUCKET_COUNT; ++i) {
+        nSeen += m_vBuckets[i].load(std::memory_order_relaxed);
+        if (nSeen >= nRank)
+            return std::min(uint64_t(1) << i, GetMax());
+    }
+    return GetMax();
+}
+
+NGemity::Metrics::Counter &NGemity::MetricsRegistry::GetCounter(const std::string &szName)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    auto &metric = m_vCounters[szName];
+    if (metric == nullptr)
+        metric = std::make_unique<Metrics::Counter>();
+    return *metric;
+}
+
+NGemity::Metrics::Gauge &NGemity::MetricsRegistry::GetGauge(const std::string &szName)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    auto &metric = m_vGauges[szName];
+    if (metric == nullptr)
+        metric = std::make_unique<Metrics::Gauge>();
+    return *metric;
+}
+
+NGemity::Metrics::Histogram &NGemity::MetricsRegistry::GetHistogram(const std::string &szName)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    auto &metric = m_vHistograms[szName];
+    if (metric == nullptr)
+        metric = std::make_unique<Metrics::Histogram>();
+    return *metric;
+}
+
+void NGemity::MetricsRegistry::RegisterSampler(const std::string &szName, std::function<int64_t()> fnSampler)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    m_vSamplers[szName] = std::move(fnSampler);
+}
+
+void NGemity::MetricsRegistry::UnregisterSampler(const std::string &szName)
+{
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    m_vSamplers.erase(szName);
+}
+
+void NGemity::MetricsRegistry::InitializeMetrics()
+{
+    m_szSnapshotFile = sConfigMgr->GetStringDefault("Metrics.File", "");
+    m_SnapshotTimer.SetInterval(std::max(sConfigMgr->GetIntDefault("Metrics.Interval", 10), 1) * 1000);
+    if (!m_szSnapshotFile.empty())
+        NG_LOG_INFO("server.metrics", "Writing metrics to %s every %d seconds.", m_szSnapshotFile.c_str(), static_cast<int32_t>(m_SnapshotTimer.GetInterval() / 1000));
+}
+
+void NGemity::MetricsRegistry::Update(uint32_t diff)
+{
+    if (m_szSnapshotFile.empty())
+        return;
+
+    m_SnapshotTimer.Update(diff);
+    if (!m_SnapshotTimer.Passed())
+        return;
+    m_SnapshotTimer.Reset();
+
+    // Write aside and rename, a scraper must never read half a file
+    std::string szTempFile = m_szSnapshotFile + ".tmp";
+    std::ofstream outFile(szTempFile, std::ios::out | std::ios::trunc);
+    if (!outFile.is_open()) {
+        NG_LOG_ERROR("server.metrics", "Cannot write metrics to %s", szTempFile.c_str());
+        return;
+    }
+    outFile << Snapshot();
+    outFile.close();
+    std::rename(szTempFile.c_str(), m_szSnapshotFile.c_str());
+}
+
+std::string NGemity::MetricsRegistry::Snapshot()
+{
+    nlohmann::json root;
+    root["last_update"] = time(nullptr);
+    root["counters"] = nlohmann::json::object();
+    root["gauges"] = nlohmann::json::object();
+    root["histograms"] = nlohmann::json::object();
+
+    std::lock_guard<std::mutex> lock(m_pMutex);
+    for (const auto &[szName, metric] : m_vCounters)
+        root["counters"][szName] = metric->Get();
+    for (const auto &[szName, metric] : m_vGauges)
+        root["gauges"][szName] = metric->Get();
+    for (const auto &[szName, fnSampler] : m_vSamplers)
+        root["gauges"][szName] = fnSampler();
+    for (const auto &[szName, metric] : m_vHistograms) {
+        nlohmann::json histogram;
+        uint64_t nCount = metric->GetCount();
+        histogram["count"] = nCount;
+        histogram["avg"] = nCount != 0 ? metric->GetSum() / nCount : 0;
+        histogram["p50"] = metric->Percentile(0.50);
+        histogram["p95"] = metric->Percentile(0.95);
+        histogram["p99"] = metric->Percentile(0.99);
+        histogram["max"] = metric->GetMax();
+        root["histograms"][szName] = histogram;
+    }
+    return root.dump();
+}
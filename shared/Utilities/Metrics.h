@@ -0,0 +1,141 @@
+#pragma once
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Define.h"
+#include "Timer.h"
+
+namespace NGemity {
+    namespace Metrics {
+        /// Monotonic event count
+        class Counter {
+        public:
+            void Add(uint64_t nValue = 1) { m_nValue.fetch_add(nValue, std::memory_order_relaxed); }
+            uint64_t Get() const { return m_nValue.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> m_nValue{0};
+        };
+
+        /// Current level of something (queue depth, object count, ...)
+        class Gauge {
+        public:
+            void Set(int64_t nValue) { m_nValue.store(nValue, std::memory_order_relaxed); }
+            void Add(int64_t nValue) { m_nValue.fetch_add(nValue, std::memory_order_relaxed); }
+            int64_t Get() const { return m_nValue.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<int64_t> m_nValue{0};
+        };
+
+        /// \brief Distribution of durations in microseconds
+        /// Bucket i holds values below 2^i us, the last one everything above ~33s.
+        class Histogram {
+        public:
+            static constexpr int32_t BUCKET_COUNT = 26;
+
+            void Observe(uint64_t nMicroseconds);
+            uint64_t GetCount() const { return m_nCount.load(std::memory_order_relaxed); }
+            uint64_t GetSum() const { return m_nSum.load(std::memory_order_relaxed); }
+            uint64_t GetMax() const { return m_nMax.load(std::memory_order_relaxed); }
+            /// \brief Upper bound of the bucket holding the given rank
+            /// \param fRatio 0.5 for the median, 0.99 for p99
+            uint64_t Percentile(double fRatio) const;
+
+        private:
+            std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_vBuckets{};
+            std::atomic<uint64_t> m_nCount{0};
+            std::atomic<uint64_t> m_nSum{0};
+            std::atomic<uint64_t> m_nMax{0};
+        };
+
+        /// Observes the lifetime of the scope into a histogram
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(Histogram &histogram)
+                : m_Histogram(histogram)
+                , m_tStart(std::chrono::steady_clock::now())
+            {
+            }
+
+            ~ScopedTimer() { m_Histogram.Observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_tStart).count()); }
+
+            ScopedTimer(const ScopedTimer &) = delete;
+            ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+        private:
+            Histogram &m_Histogram;
+            std::chrono::steady_clock::time_point m_tStart;
+        };
+    } // namespace Metrics
+
+    /// \brief Process wide registry of named counters, gauges and histograms
+    /// Lookups by name take a lock, so hot paths resolve their metric once and keep the reference:
+    /// metrics are never removed and their addresses stay valid for the whole process.
+    /// Updating a metric is a single relaxed atomic operation.
+    class MetricsRegistry {
+    public:
+        static MetricsRegistry &Instance()
+        {
+            static MetricsRegistry instance;
+            return instance;
+        }
+
+        ~MetricsRegistry() = default;
+        // Deleting the copy & assignment operators
+        // Better safe than sorry
+        MetricsRegistry(const MetricsRegistry &) = delete;
+        MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+        Metrics::Counter &GetCounter(const std::string &szName);
+        Metrics::Gauge &GetGauge(const std::string &szName);
+        Metrics::Histogram &GetHistogram(const std::string &szName);
+
+        /// \brief Registers a gauge that is only read when a snapshot is taken
+        /// Meant for values that already exist somewhere else, like a queue size.
+        void RegisterSampler(const std::string &szName, std::function<int64_t()> fnSampler);
+        void UnregisterSampler(const std::string &szName);
+
+        /// \brief Reads Metrics.File and Metrics.Interval from the config
+        void InitializeMetrics();
+        /// \brief Writes the snapshot file once the interval has passed
+        void Update(uint32_t diff);
+        /// \return every metric as json
+        std::string Snapshot();
+
+    private:
+        MetricsRegistry() = default;
+
+        std::mutex m_pMutex;
+        std::map<std::string, std::unique_ptr<Metrics::Counter>> m_vCounters{};
+        std::map<std::string, std::unique_ptr<Metrics::Gauge>> m_vGauges{};
+        std::map<std::string, std::unique_ptr<Metrics::Histogram>> m_vHistograms{};
+        std::map<std::string, std::function<int64_t()>> m_vSamplers{};
+
+        std::string m_szSnapshotFile{};
+        IntervalTimer m_SnapshotTimer{};
+    };
+} // namespace NGemity
+#define sMetrics NGemity::MetricsRegistry::Instance()
@@ -0,0 +1,198 @@
+/*
+ *  Copyright (C) 2017-2020 NGemity <https://ngemity.org/>
+ *
+ *  This program is free software; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 3 of the License, or (at your
+ *  option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful, but WITHOUT
+ *  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ *  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ *  more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "GameClient/TS_SC_ENTER.h"
+#include "GameClient/TS_SC_HPMP.h"
+#include "GameClient/TS_SC_INVENTORY.h"
+#include "GameClient/TS_SC_MOVE.h"
+#include "MessageSerializerBuffer.h"
+#include "PacketEpics.h"
+
+/// Serializes representative packets through VersionedSerializerBuffer and SerializePacket
+/// for every version in NG_SPECIALIZED_PACKET_VERSIONS, the bytes have to match the ones
+/// written by the generic MessageSerializerBuffer with its runtime version checks.
+
+namespace {
+    int32_t g_nFailures = 0;
+
+    bool samePacket(const XPacket &lhs, const XPacket &rhs) { return lhs.size() == rhs.size() && (lhs.size() == 0 || memcmp(lhs.contents(), rhs.contents(), lhs.size()) == 0); }
+
+    template<int Version, class TS_SERIALIZABLE_PACKET>
+    void comparePacket(const char *szName, const TS_SERIALIZABLE_PACKET &packet)
+    {
+        XPacket generic{};
+        MessageSerializerBuffer genericSerializer(&generic, Version);
+        packet.serialize(&genericSerializer);
+        genericSerializer.getFinalizedPacket();
+
+        XPacket specialized{};
+        VersionedSerializerBuffer<Version> specializedSerializer(&specialized);
+        packet.serialize(&specializedSerializer);
+        specializedSerializer.getFinalizedPacket();
+
+        XPacket dispatched{};
+        SerializePacket(packet, &dispatched, Version);
+
+        if (!samePacket(generic, specialized) || !samePacket(generic, dispatched)) {
+            printf("FAIL %s version 0x%06x: generic %zu bytes, specialized %zu bytes, SerializePacket %zu bytes\n", szName, Version, generic.size(), specialized.size(), dispatched.size());
+            ++g_nFailures;
+            return;
+        }
+        printf("ok   %s version 0x%06x: %zu bytes\n", szName, Version, generic.size());
+    }
+
+    TS_SC_ENTER makePlayerEnter()
+    {
+        TS_SC_ENTER enterPct{};
+        enterPct.type = 2;
+        enterPct.handle = 0x80001234;
+        enterPct.x = 116012.5f;
+        enterPct.y = 58040.25f;
+        enterPct.z = 12.0f;
+        enterPct.layer = 1;
+        enterPct.objType = EOT_Player;
+        auto &creature = enterPct.playerInfo.creatureInfo;
+        creature.status = 0x20;
+        creature.face_direction = 1.5f;
+        creature.hp = 4200;
+        creature.max_hp = 5000;
+        creature.mp = 310;
+        creature.max_mp = 800;
+        creature.level = 120;
+        creature.race = 4;
+        creature.skin_color = 0xFFEEDD;
+        creature.is_first_enter = true;
+        creature.energy = 3;
+        enterPct.playerInfo.sex = 2;
+        enterPct.playerInfo.faceId = 101;
+        enterPct.playerInfo.faceTextureId = 7;
+        enterPct.playerInfo.hairId = 201;
+        enterPct.playerInfo.hairColorIndex = 3;
+        enterPct.playerInfo.hairColorRGB = 0x102030;
+        enterPct.playerInfo.hideEquipFlag = 1;
+        enterPct.playerInfo.szName = "Serializer";
+        enterPct.playerInfo.job_id = 303;
+        enterPct.playerInfo.ride_handle = 0x80004321;
+        enterPct.playerInfo.guild_id = 17;
+        enterPct.playerInfo.title_code = 5;
+        enterPct.playerInfo.emblem_code = 9;
+        return enterPct;
+    }
+
+    TS_SC_ENTER makeMonsterEnter()
+    {
+        TS_SC_ENTER enterPct{};
+        enterPct.type = 1;
+        enterPct.handle = 0xC0000042;
+        enterPct.x = 120000.0f;
+        enterPct.y = 60000.0f;
+        enterPct.objType = EOT_Monster;
+        auto &creature = enterPct.monsterInfo.creatureInfo;
+        creature.hp = 900;
+        creature.max_hp = 900;
+        creature.level = 45;
+        creature.race = 12;
+        enterPct.monsterInfo.monster_id = 110100;
+        enterPct.monsterInfo.is_tamed = false;
+        return enterPct;
+    }
+
+    TS_SC_MOVE makeMove()
+    {
+        TS_SC_MOVE movePct{};
+        movePct.start_time = 123456;
+        movePct.handle = 0x80001234;
+        movePct.tlayer = 1;
+        movePct.speed = 42;
+        for (int32_t i = 0; i < 3; ++i) {
+            MOVE_INFO moveInfo{};
+            moveInfo.tx = 116000.0f + i * 12.0f;
+            moveInfo.ty = 58000.0f - i * 6.0f;
+            movePct.move_infos.emplace_back(moveInfo);
+        }
+        return movePct;
+    }
+
+    TS_SC_HPMP makeHPMP()
+    {
+        TS_SC_HPMP hpmpPct{};
+        hpmpPct.handle = 0x80001234;
+        hpmpPct.add_hp = -250;
+        hpmpPct.hp = 3950;
+        hpmpPct.max_hp = 5000;
+        hpmpPct.add_mp = 40;
+        hpmpPct.mp = 350;
+        hpmpPct.max_mp = 800;
+        hpmpPct.need_to_display = 1;
+        return hpmpPct;
+    }
+
+    TS_SC_INVENTORY makeInventory()
+    {
+        TS_SC_INVENTORY inventoryPct{};
+        for (int32_t i = 0; i < 2; ++i) {
+            TS_ITEM_INFO itemInfo{};
+            itemInfo.base_info.handle = 0x40000100 + i;
+            itemInfo.base_info.code = 101100 + i;
+            itemInfo.base_info.uid = 0x0000000500000001LL + i;
+            itemInfo.base_info.count = 3000000000LL;
+            itemInfo.base_info.ethereal_durability = 50;
+            itemInfo.base_info.endurance = 70000;
+            itemInfo.base_info.enhance = 5;
+            itemInfo.base_info.level = 3;
+            itemInfo.base_info.flag = 0x11;
+            itemInfo.base_info.socket[0] = 700101;
+            itemInfo.base_info.awaken_option.value[0] = 4;
+            itemInfo.base_info.awaken_option.data[0] = 16;
+            itemInfo.base_info.random_type[1] = 2;
+            itemInfo.base_info.random_value_1[1] = 30;
+            itemInfo.base_info.random_value_2[1] = -30;
+            itemInfo.base_info.remain_time = 3600;
+            itemInfo.base_info.elemental_effect_type = 1;
+            itemInfo.base_info.elemental_effect_remain_time = 60;
+            itemInfo.base_info.appearance_code = 102200;
+            itemInfo.base_info.summon_code = 0;
+            itemInfo.wear_position = static_cast<int16_t>(i == 0 ? 0 : -1);
+            itemInfo.own_summon_handle = 0;
+            itemInfo.index = i;
+            inventoryPct.items.emplace_back(itemInfo);
+        }
+        return inventoryPct;
+    }
+
+    template<int Version>
+    void compareVersion()
+    {
+        comparePacket<Version>("TS_SC_ENTER (player)", makePlayerEnter());
+        comparePacket<Version>("TS_SC_ENTER (monster)", makeMonsterEnter());
+        comparePacket<Version>("TS_SC_MOVE", makeMove());
+        comparePacket<Version>("TS_SC_HPMP", makeHPMP());
+        comparePacket<Version>("TS_SC_INVENTORY", makeInventory());
+    }
+} // namespace
+
+int main()
+{
+#define NG_COMPARE_VERSION(version_) compareVersion<version_>();
+    NG_SPECIALIZED_PACKET_VERSIONS(NG_COMPARE_VERSION)
+#undef NG_COMPARE_VERSION
+
+    return g_nFailures == 0 ? 0 : 1;
+}